@@ -0,0 +1,45 @@
+#pragma once
+// ----------------------------------------------------------
+// [ȴ ] ̷ θ ĭ ĭ ɾ ٴϴ NPC ¸ Ʈ 迭
+// Ʈ i ĭ cur ĭ next   (progress 0 ~ 1), ϸ prev = cur, cur = next
+//  ĭ  /  ˻ / ġ  ڸ ƴ  (CubePlanet updateAgents)
+// Ʈ   Ƿ    尡  ص 
+// ----------------------------------------------------------
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+struct AgentCrowd {
+    std::vector<int> curFace, curRow, curCol;    //  ĭ
+    std::vector<int> nextFace, nextRow, nextCol; //  ĭ
+    std::vector<int> prevFace, prevRow, prevCol; //   ĭ (ǵư ʱ )
+    std::vector<float> progress;                 // cur -> next  (0 ~ 1)
+    std::vector<float> speed;                    // ʴ ĭ 
+    std::vector<uint32_t> rng;                   // Ʈ  (xorshift32,     )
+    std::vector<float> pos;                      // 3 (x, y, z), ༺  ǥ ״ glVertexPointer
+
+    int size() const { return (int)progress.size(); }
+
+    // þ ڸ 0 (rng 1), ִ ڸ ״
+    void resize(int count) {
+        curFace.resize(count, 0); curRow.resize(count, 0); curCol.resize(count, 0);
+        nextFace.resize(count, 0); nextRow.resize(count, 0); nextCol.resize(count, 0);
+        prevFace.resize(count, 0); prevRow.resize(count, 0); prevCol.resize(count, 0);
+        progress.resize(count, 0.0f);
+        speed.resize(count, 0.0f);
+        rng.resize(count, 1u);
+        pos.resize((size_t)count * 3, 0.0f);
+    }
+
+    void clear() { resize(0); }
+
+    // 0 ~ bound-1
+    static int random(uint32_t& s, int bound) {
+        s ^= s << 13; s ^= s >> 17; s ^= s << 5;
+        return (int)(s % (uint32_t)bound);
+    }
+
+    size_t memoryBytes() const {
+        return (size_t)size() * (sizeof(int) * 9 + sizeof(float) * 2 + sizeof(uint32_t) + sizeof(float) * 3);
+    }
+};
\ No newline at end of file
@@ -22,6 +22,36 @@
 
 #include <iostream>    //  Ʈ
 
+#include <cstring>     // strcmp ( ɼ)
+
+#include <chrono>      //   ð 
+
+#include <thread>      //       (sleep_for), ϲ  
+
+#include <cctype>      // tolower (Ű )
+
+#include "ModelNormals.h" // [߰]   (ε    )
+
+#include "PlanetGrid.h"   // [߰]  ߿ ũⰡ  6 
+
+#include "CubeTopology.h" // [߰]   /   / CSV ȸ ǥ
+
+#include "WallDistance.h" // [߰] ĭ    Ÿ
+
+#include "Quaternion.h"   // [߰] ༺ ȸ  (CPU ʹϾ)
+
+#include "ItemIndex.h"    // [߰] ĭ   (ݱ ˻)
+
+#include "EntityStore.h"  // [߰] Ʈ 迭 ƼƼ  ()
+
+#include "AgentCrowd.h"   // [߰] ̷θ ȴ NPC  
+
+#include "JobSystem.h"    // [߰] ϲ    
+
+#include "MazeGraph.h"    // [߰]  ĭ ׷ (CSR) + A*  ã
+
+#include "HierPath.h"     // [߰] ū ༺   ã (HPA*)
+
 
 
 //  
@@ -50,23 +80,27 @@ struct Model {
 
     std::vector<Face> faces;
 
-};
+    std::vector<Point3D> faceNormals;   // [] ε    
 
+    std::vector<Point3D> vertexNormals; // [߰]     (ε巯 )
 
+    std::vector<Point3D> cornerNormals; // [߰] 鸶 3,   ̻ 𼭸  
 
-// []  ü ( ε,  ߰)
+    GLuint list = 0;                  // [߰] ε ÷ Ʈ (0̸ )
+
+};
 
-struct Item {
 
-    int face, r, c;
 
-    bool active;
+// [߰] ޽  (glInterleavedArrays GL_T2F_N3F_V3F ġ )
 
-    float rot;
+struct MeshVertex {
 
-    int modelIdx; // 0~5    
+    float s, t;
 
-    float rColor, gColor, bColor; //  
+    float nx, ny, nz;
+
+    float x, y, z;
 
 };
 
@@ -82,7 +116,63 @@ struct Item {
 
 std::vector<Model> models;
 
-std::vector<Item> items;
+// [] Item ü 迭  Ʈ 迭 ( ۸ ϰ, ֿ  ۰ ڸ ٲ )
+
+EntityStore items;
+
+float modelCreaseAngle = 60.0f; // [߰]    𼭸  (180 =  ε巴, 0 =   )
+
+ItemIndex itemIndex; // [߰]  id  ĭ (ݱ ˻ ÷̾ ó ĭ )
+
+const float ITEM_PICKUP_DIST = 4.0f;
+
+
+
+// [߰] ̷θ ȴ NPC (--agents K , 0̸ )
+
+AgentCrowd agents;
+
+JobSystem agentJobs;               // ƽ Ʈ   ô ϲ۵ (ھ  - 1) [] initMap HPA*  ׷ ⵵
+
+int agentCount = 0;                // ⺻  ( )
+
+const int AGENT_BATCH = 1024;      // ϲ    Ʈ 
+
+const float AGENT_SPEED_MIN = 1.5f, AGENT_SPEED_MAX = 3.0f; // ʴ ĭ 
+
+const float AGENT_LIFT = 0.5f;     // ٴڿ  ʰ  
+
+
+
+// [߰]  ã:  ĭ ׷   ۱ θ ǥ ('R')
+
+// [] ׷ ε  ƴ϶ θ ó ã  ,  ġ    ٽ 
+
+MazeGraph mazeGraph;
+
+PathFinder pathFinder;
+
+bool mazeGraphDirty = true;        //  ٲ ׷  ʰ ٸ (Ǵ  )
+
+std::vector<CubeCell> itemRoute;   // ÷̾ ĭ ~    ĭ []  ȣ  ĭ (HPA* ׷  ã)
+
+std::vector<int> routeNodes;       // ׷ A*  ( ȣ)
+
+float itemRouteCost = 0.0f;        //   (, planetRadius ϸ Ÿ)
+
+int itemRouteFrom = -1, itemRouteItems = -1; // θ    ĭ ((f * N + r) * N + c) /   
+
+bool showRoute = false;
+
+const int ROUTE_CANDIDATES = 8;    // [] ǥ Ģ (  ):    ̸ŭ  ̷ ΰ  ª 
+
+HierPath hierPath;                 // [߰] Ŭ /   ׷ [] N HIER_PATH_MIN_N ̸̻ initMap  ( ߿  )
+
+const int HIER_PATH_MIN_N = 256;   //  ũ  ǥÿ HPA* ( Ʒ ׷ ü A*  )
+
+const float HIER_PATH_WEIGHT = 1.5f; // ȳ  % ư Ǵ ޸ƽ Ű  带   (ġ [HPA] )
+
+int itemRouteExpanded = 0;         // θ ã    (HPA*  )
 
 
 
@@ -96,12 +186,24 @@ int totalItems = 3;
 
 
 
-GLuint texWall, texFloor;
+// [] /ٴ ؽó Ʋ   ħ (  = ,   = ٴ)
+
+const int ATLAS_TILE = 64;  // Ÿ   ũ (ȼ)
+
+const int ATLAS_TILES = 2;  // η  Ÿ 
+
+enum { TILE_WALL = 0, TILE_FLOOR = 1 };
+
+GLuint texAtlas = 0;
 
 int viewMode = 0;
 
 
 
+// [] ༺ ȸ ´ ʹϾ ϰ,  ׸  display() 
+
+Quat planetOrientation;
+
 GLfloat planetRotationMatrix[16] = { 1,0,0,0, 0,1,0,0, 0,0,1,0, 0,0,0,1 };
 
 float cameraYaw = 0.0f, cameraPitch = 0.0f;
@@ -116,177 +218,319 @@ bool mouseCaptured = true;
 
 
 
+// [߰] 콺 ̵ ̺Ʈ ٷ  ʰ  ξٰ ƽ   
+
+// ʹ â ڸ    ǵ (ǵ  ̵ ̺Ʈ ϳ  Ƿ)
+
+const int MOUSE_EDGE_MARGIN = 100;     // ڸ  ȼ   ǵ (â  1/4)
+
+int mouseLastX = -1, mouseLastY = -1;  //  ̺Ʈ ġ (-1 =  )
+
+int mouseWarpWait = 0;                 // ǵ   ó ̺Ʈ ٸ  ̺Ʈ  (0 =  ٸ)
+
+int mouseDX = 0, mouseDY = 0;          //    ̵ (ȼ)
+
+long long mouseEventsReceived = 0, mouseDeltasApplied = 0, mouseWarps = 0;
+
+
+
+// [߰]  ð  ùķ̼: Ű / ¸ ϰ, ̵ idle ƽ 
+
+// Ű ݺ ӵ ȭ ֻ   ð   Ÿ 
+
+const double SIM_TICK = 1.0 / 60.0;   //  ƽ ()
+
+const double SIM_MAX_FRAME = 0.25;    //    ִ ð (â    Ƽ  ʰ)
+
+const float MOVE_DEG_PER_SEC = 45.0f; // BASE_RADIUS ༺ ʴ ȸ  (: Ű ݺ  30ȸ/ x 1.5)
+
+bool keyDown[256] = {};               // ҹ 
+
+double simAccumulator = 0.0;          //  ùķ̼  ð ()
+
+long long simTicks = 0;
+
+bool redrawPending = true;            // Է/ùķ̼ ȭ ٲ ->  idle   ٽ ׸
+
+
+
 int winW = 1200, winH = 800;
 
 
 
-// [ ]  ػ 15,    (FRONT=0)
+// []  ػ󵵴 ҷ CSV ũ  (  15),  ȣ CubeTopology.h (FRONT=0)
 
-const int N = 15;
+int N = 15;
 
-enum { FACE_FRONT = 0, FACE_BACK = 1, FACE_RIGHT = 2, FACE_LEFT = 3, FACE_TOP = 4, FACE_BOTTOM = 5 };
 
 
+PlanetGrid grid; // grid.at(, , )
 
-int map[6][N][N] = { 0 };
+WallBits wallBits; // [߰]   1Ʈ + ¿  Ʈ (޽/浹 ⼭ )
 
+WallDistance wallDistance; // [߰]  Ÿ (wallBits ٲ   )
 
+std::string mapPrefix = "map_"; // --map ɼ ٸ  Ʈ (ξ_front.csv ...)
 
-// ----------------------------------------------------------
 
-// [Լ ]
 
-// ----------------------------------------------------------
+// ĭ ũ⸦ N = 15,  80    (N Ŀ ༺ Ŀ)
 
-int getNeighborValue(int f, int r, int c);
+const int BASE_N = 15;
 
-Point3D getSpherePoint(int face, float u, float v, float r);
+const float BASE_RADIUS = 80.0f;
 
-Point3D multiplyMatrixVector(Point3D p, GLfloat* m);
 
-bool checkCollision();
 
+// [߰]  ޽ ûũ:   chunkSize x chunkSize ĭ ŸϷ   ´
 
+// ĭ ϳ ٲ  ĭ ̿ ĭ  ûũ ٽ 
 
-// ----------------------------------------------------------
+// [] ûũ ũ/ N   (resizeWallChunks)
 
-// [ؽó ]
+int chunkSize = 8;
 
-// ----------------------------------------------------------
+int chunksPerSide = 0;
 
-void makeCheckImage(int type) {
+int chunkCount = 0;
 
-    const int width = 64; const int height = 64;
 
-    GLubyte image[height][width][3];
 
-    for (int i = 0; i < height; i++) {
+struct WallChunk {
 
-        for (int j = 0; j < width; j++) {
+    GLuint list = 0;    // ÷ Ʈ (GPU  )
 
-            int c;
+    int quadCount = 0;
 
-            if (type == 0) { //  (Cyan)
+    bool dirty = true;
 
-                if ((i & 16) == 0 ^ (j & 16) == 0) c = 255; else c = 100;
+    Point3D boundCenter; // ø   (༺  ǥ)
 
-                image[i][j][0] = 0; image[i][j][1] = c; image[i][j][2] = c;
+    float boundRadius = 0.0f;
 
-            }
+    int lastDrawnFrame = -1; // [߰]    ûũ Ʈ 
 
-            else { // ٴ (Dark Blue)
+};
 
-                c = ((((i & 0x8) == 0) ^ ((j & 0x8)) == 0)) * 255;
+std::vector<WallChunk> wallChunks;
 
-                image[i][j][0] = c / 4; image[i][j][1] = c / 4; image[i][j][2] = c / 2 + 50;
+int wallQuadCount = 0;
 
-            }
 
-        }
 
-    }
+// [߰] 浹: ÷̾ ĭ ֺ ˻   ĭ    (ĭ  -> ,   ĭ  ŭ)
 
-    GLuint* targetTex = (type == 0) ? &texWall : &texFloor;
+const float COLLISION_DIST = 3.5f;
 
-    glGenTextures(1, targetTex); glBindTexture(GL_TEXTURE_2D, *targetTex);
+float cellBoundRadius = 0.0f;
 
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
 
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
 
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+// [߰] ū ༺ ó   ʰ ̴ ûũ Ӹ ݾ 
 
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+const int EAGER_BAKE_MAX_N = 128;    //  ũ    
 
-    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB, width, height, 0, GL_RGB, GL_UNSIGNED_BYTE, image);
+const int BAKE_BUDGET_PER_FRAME = 16; // Ӵ   ûũ 
 
-}
+const int MAX_BAKED_CHUNKS = 4096;    // ̺     ̴ ͺ 
+
+const int EVICT_AFTER_FRAMES = 120;
+
+int frameCounter = 0;
+
+int bakedChunkCount = 0;
+
+int bakesThisFrame = 0;
+
+
+
+// [߰] ü ø: ༺  ǥ ű  6 (ax + by + cz + d >= 0  )
+
+struct Frustum { float planes[6][4]; };
+
+Frustum cullFrustum;
+
+bool cullingEnabled = true;
+
+
+
+// Ӹ ׸  / ɷ   ( ȭ鿡 ǥ)
+
+struct CullStats { int chunksDrawn, chunksCulled, itemsDrawn, itemsCulled; };
+
+CullStats cullStats = { 0, 0, 0, 0 };
+
+
+
+// [߰] ؽó/  : ̹ ɷ ִ ¸ GL ٽ θ 
+
+struct RenderStats { int binds, bindsSkipped, texToggles, materialChanges; };
+
+RenderStats renderStats = { 0, 0, 0, 0 };
+
+GLuint boundTexture = 0;
+
+bool texturingOn = false;
+
+struct MaterialState { GLfloat diff[4], spec[4]; GLfloat shininess; bool valid; };
+
+MaterialState currentMaterial = { {0}, {0}, 0, false };
+
+
+
+// [߰]   ȭ(Navi / Absolute) ĳ
+
+// ȭ ؽó  ΰ, ༺   ̻ Ұų  ٲ  ٽ ׸
+
+struct ViewCache {
+
+    GLuint tex = 0;
+
+    int texW = 0, texH = 0;    // 2 ŵ ؽó ũ
+
+    int w = 0, h = 0;          //  Ʈ ũ
+
+    bool valid = false;
+
+    GLfloat rot[16];           //   planetRotationMatrix
+
+    float yaw = 0.0f;          //   cameraYaw (Navi )
+
+    int sceneVersion = -1;
+
+    long long agentSteps = 0;  //   agentSteps
+
+};
+
+ViewCache naviCache, absCache;
+
+const float VIEW_CACHE_ANGLE_DEG = 2.0f; //     ٽ ׸
+
+const int VIEW_CACHE_AGENT_TICKS = 6;    // [߰] NPC  ƽ (0.1)ŭ     ׸ 
+
+int sceneVersion = 0;      // / ٲ  
+
+long long agentSteps = 0;  // [߰] NPC  ƽ  ( ƽ ٲǷ sceneVersion  )
+
+int auxViewsRendered = 0, auxViewsCached = 0; // ̹  
+
+
+
+// [߰] ٴ ޽: ʰ  ť- , ĭ ϳ 2x2 簢
+
+// N̳  ٲ ٽ 
+
+// [] N ũ ٴ ĭ FLOOR_MAX_CELLS ٿ  (ٴ  ̶  󰡸 )
+
+const int FLOOR_MAX_CELLS = 128;
+
+GLuint floorList = 0;
+
+int floorBuiltN = 0;
+
+float floorBuiltRadius = 0.0f;
 
 
 
 // ----------------------------------------------------------
 
-// [ ƿƼ]
+// [Լ ]
 
 // ----------------------------------------------------------
 
-Point3D calculateNormal(Point3D p1, Point3D p2, Point3D p3) {
+int getNeighborValue(int f, int r, int c);
 
-    Point3D u = { p2.x - p1.x, p2.y - p1.y, p2.z - p1.z };
+void resolveNeighbor(int f, int r, int c, int& tf, int& tr, int& tc);
 
-    Point3D v = { p3.x - p1.x, p3.y - p1.y, p3.z - p1.z };
+Point3D getSpherePoint(int face, float u, float v, float r);
 
-    Point3D n = { u.y * v.z - u.z * v.y, u.z * v.x - u.x * v.z, u.x * v.y - u.y * v.x };
+Point3D multiplyMatrixVector(Point3D p, GLfloat* m);
 
-    float len = sqrt(n.x * n.x + n.y * n.y + n.z * n.z);
+bool checkCollision();
 
-    if (len > 0) { n.x /= len; n.y /= len; n.z /= len; }
+void bakeWallMesh();
 
-    return n;
+void markAllWallChunksDirty();
 
-}
+void bakeFloorMesh();
 
+void resizeWallChunks();
 
+void rebuildWallBits();
 
-Point3D normalize(Point3D p) {
+std::vector<int> setMapCell(int f, int r, int c, int val);
 
-    float len = sqrt(p.x * p.x + p.y * p.y + p.z * p.z);
+void invalidateMazeGraph();
 
-    if (len == 0) return { 0, 0, 0 };
 
-    return { p.x / len, p.y / len, p.z / len };
+
+// ----------------------------------------------------------
+
+// [ؽó ]  ٲٱ (ٲ  GL ȣ, Ƚ Ӹ )
+
+// ----------------------------------------------------------
+
+void bindTexture(GLuint tex) {
+
+    if (tex == boundTexture) { renderStats.bindsSkipped++; return; }
+
+    glBindTexture(GL_TEXTURE_2D, tex);
+
+    boundTexture = tex;
+
+    renderStats.binds++;
 
 }
 
 
 
-Point3D getSpherePoint(int face, float u, float v, float r) {
+void setTexturing(bool on) {
 
-    float x = (u - 0.5f) * 2.0f;
+    if (on == texturingOn) return;
 
-    float y = (v - 0.5f) * 2.0f;
+    if (on) glEnable(GL_TEXTURE_2D); else glDisable(GL_TEXTURE_2D);
 
-    float z = 1.0f;
+    texturingOn = on;
 
-    Point3D p = { 0, 0, 0 };
+    renderStats.texToggles++;
 
-    switch (face) {
+}
 
-    case FACE_BACK:  p = { x, y, z }; break;
 
-    case FACE_FRONT:   p = { -x, y, -z }; break;
 
-    case FACE_RIGHT:  p = { z, y, -x }; break;
+void setMaterial(const GLfloat* diff, const GLfloat* spec, GLfloat shininess) {
 
-    case FACE_LEFT:   p = { -z, y, x }; break;
+    MaterialState& m = currentMaterial;
 
-    case FACE_TOP:    p = { x, z, -y }; break;
+    if (m.valid && memcmp(m.diff, diff, sizeof(m.diff)) == 0 && memcmp(m.spec, spec, sizeof(m.spec)) == 0 && m.shininess == shininess) return;
 
-    case FACE_BOTTOM: p = { x, -z, y }; break;
+    glMaterialfv(GL_FRONT_AND_BACK, GL_AMBIENT_AND_DIFFUSE, diff);
 
-    }
+    glMaterialfv(GL_FRONT_AND_BACK, GL_SPECULAR, spec);
 
-    p = normalize(p);
+    glMaterialf(GL_FRONT_AND_BACK, GL_SHININESS, shininess);
 
-    p.x *= r; p.y *= r; p.z *= r;
+    memcpy(m.diff, diff, sizeof(m.diff)); memcpy(m.spec, spec, sizeof(m.spec));
 
-    return p;
+    m.shininess = shininess; m.valid = true;
+
+    renderStats.materialChanges++;
 
 }
 
 
 
-Point3D multiplyMatrixVector(Point3D p, GLfloat* m) {
+// Ʋ Ÿ  (s, t) [0~1]  Ʋ ü ǥ
 
-    Point3D res;
+// Ӹ Ʒ ܰ迡  Ÿ   ʵ ׵θ 1ؼ  
 
-    res.x = m[0] * p.x + m[4] * p.y + m[8] * p.z + m[12];
+void atlasUV(int tile, float s, float t, float& u, float& v) {
 
-    res.y = m[1] * p.x + m[5] * p.y + m[9] * p.z + m[13];
+    const float inset = 1.0f / ATLAS_TILE;
 
-    res.z = m[2] * p.x + m[6] * p.y + m[10] * p.z + m[14];
+    u = (tile + inset + s * (1.0f - 2.0f * inset)) / ATLAS_TILES;
 
-    return res;
+    v = inset + t * (1.0f - 2.0f * inset);
 
 }
 
@@ -294,77 +538,115 @@ Point3D multiplyMatrixVector(Point3D p, GLfloat* m) {
 
 // ----------------------------------------------------------
 
-// [CSV ε] 0, 1   
+// [ؽó ] üũ    Ʋ Ÿ ڸ ׸
 
 // ----------------------------------------------------------
 
-void loadMapFromCSV(int face, const char* filename, int angle) {
+void makeCheckImage(int type, GLubyte* atlas, int atlasW) {
+
+    const int width = ATLAS_TILE; const int height = ATLAS_TILE;
+
+    for (int i = 0; i < height; i++) {
+
+        for (int j = 0; j < width; j++) {
+
+            GLubyte* px = atlas + (i * atlasW + type * ATLAS_TILE + j) * 3;
+
+            int c;
+
+            if (type == TILE_WALL) { //  (Cyan)
+
+                if ((i & 16) == 0 ^ (j & 16) == 0) c = 255; else c = 100;
+
+                px[0] = 0; px[1] = c; px[2] = c;
+
+            }
+
+            else { // ٴ (Dark Blue)
+
+                c = ((((i & 0x8) == 0) ^ ((j & 0x8)) == 0)) * 255;
+
+                px[0] = c / 4; px[1] = c / 4; px[2] = c / 2 + 50;
 
-    std::ifstream file(filename);
+            }
 
-    if (!file.is_open()) return;
+        }
 
+    }
 
+}
 
-    int rot = angle % 360;
 
-    if (rot < 0) rot += 360;
 
+// Ʋ󽺸  Ӹ  2x2  ٿ ø
 
+// (Ÿ ũⰡ 2 ŵ̶ 2x2  Ÿ 踦   -> Ÿϳ  )
 
-    std::string line;
+void buildTextureAtlas() {
 
-    int fileRow = 0;
+    int w = ATLAS_TILE * ATLAS_TILES, h = ATLAS_TILE;
 
-    while (std::getline(file, line) && fileRow < N) {
+    std::vector<GLubyte> level(w * h * 3);
 
-        std::stringstream ss(line);
+    for (int t = 0; t < ATLAS_TILES; t++) makeCheckImage(t, level.data(), w);
 
-        std::string cell;
 
-        int fileCol = 0;
 
-        while (std::getline(ss, cell, ',') && fileCol < N) {
+    if (texAtlas == 0) glGenTextures(1, &texAtlas);
 
-            int val = 0;
+    bindTexture(texAtlas);
 
-            try { val = std::stoi(cell); }
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1); //   ܰ   4Ʈ  ƴ
 
-            catch (...) { val = 0; }
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
 
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
 
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
 
-            if (val == 0) val = 1; else if (val == 1) val = 0; // 
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
 
 
 
-            int tr = fileRow, tc = fileCol;
+    int lv = 0;
 
-            switch (rot) {
+    while (true) {
 
-            case 0:   tr = fileRow; tc = fileCol; break;
+        glTexImage2D(GL_TEXTURE_2D, lv, GL_RGB, w, h, 0, GL_RGB, GL_UNSIGNED_BYTE, level.data());
 
-            case 90:  tr = fileCol; tc = N - 1 - fileRow; break;
+        if (w == 1 && h == 1) break;
 
-            case 180: tr = N - 1 - fileRow; tc = N - 1 - fileCol; break;
+        int nw = (w > 1) ? w / 2 : 1, nh = (h > 1) ? h / 2 : 1;
 
-            case 270: tr = N - 1 - fileCol; tc = fileRow; break;
+        int sx = w / nw, sy = h / nh;
 
-            }
+        std::vector<GLubyte> next(nw * nh * 3);
 
-            map[face][tr][tc] = val;
+        for (int y = 0; y < nh; y++) {
 
-            fileCol++;
+            for (int x = 0; x < nw; x++) {
+
+                for (int ch = 0; ch < 3; ch++) {
+
+                    int sum = 0;
+
+                    for (int dy = 0; dy < sy; dy++)
+
+                        for (int dx = 0; dx < sx; dx++) sum += level[((y * sy + dy) * w + x * sx + dx) * 3 + ch];
+
+                    next[(y * nw + x) * 3 + ch] = (GLubyte)(sum / (sx * sy));
+
+                }
+
+            }
 
         }
 
-        fileRow++;
+        level.swap(next); w = nw; h = nh; lv++;
 
     }
 
-    file.close();
-
-    std::cout << "Map Loaded: " << filename << std::endl;
+    printf("Texture Atlas: %dx%d, %d tiles, %d mip levels\n", ATLAS_TILE * ATLAS_TILES, ATLAS_TILE, ATLAS_TILES, lv + 1);
 
 }
 
@@ -372,963 +654,3455 @@ void loadMapFromCSV(int face, const char* filename, int angle) {
 
 // ----------------------------------------------------------
 
-// [ ε ]  ġ ȭ (  üũ ߰)
-
-//  ְų, оµ (Face)  0  
+// [ ƿƼ]
 
 // ----------------------------------------------------------
 
-void loadModel(const char* filename) {
+Point3D calculateNormal(Point3D p1, Point3D p2, Point3D p3) {
+
+    Point3D u = { p2.x - p1.x, p2.y - p1.y, p2.z - p1.z };
+
+    Point3D v = { p3.x - p1.x, p3.y - p1.y, p3.z - p1.z };
+
+    Point3D n = { u.y * v.z - u.z * v.y, u.z * v.x - u.x * v.z, u.x * v.y - u.y * v.x };
+
+    float len = sqrt(n.x * n.x + n.y * n.y + n.z * n.z);
+
+    if (len > 0) { n.x /= len; n.y /= len; n.z /= len; }
+
+    return n;
+
+}
+
+
+
+Point3D normalize(Point3D p) {
+
+    float len = sqrt(p.x * p.x + p.y * p.y + p.z * p.z);
+
+    if (len == 0) return { 0, 0, 0 };
+
+    return { p.x / len, p.y / len, p.z / len };
+
+}
+
+
+
+// [߰]  //Į// ( 浹)
+
+Point3D vec3Add(Point3D a, Point3D b) { return { a.x + b.x, a.y + b.y, a.z + b.z }; }
+
+Point3D vec3Sub(Point3D a, Point3D b) { return { a.x - b.x, a.y - b.y, a.z - b.z }; }
+
+Point3D vec3Scale(Point3D a, float s) { return { a.x * s, a.y * s, a.z * s }; }
+
+float vec3Dot(Point3D a, Point3D b) { return a.x * b.x + a.y * b.y + a.z * b.z; }
+
+Point3D vec3Cross(Point3D a, Point3D b) { return { a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z, a.x * b.y - a.y * b.x }; }
+
+
+
+Point3D getSpherePoint(int face, float u, float v, float r) {
+
+    float x = (u - 0.5f) * 2.0f;
+
+    float y = (v - 0.5f) * 2.0f;
+
+    Point3D p = cubeFacePoint<Point3D>(face, x, y, 1.0f); // []   CubeTopology.h ǥ ϳ
+
+    p = normalize(p);
+
+    p.x *= r; p.y *= r; p.z *= r;
+
+    return p;
+
+}
+
+
+
+Point3D multiplyMatrixVector(Point3D p, GLfloat* m) {
+
+    Point3D res;
+
+    res.x = m[0] * p.x + m[4] * p.y + m[8] * p.z + m[12];
+
+    res.y = m[1] * p.x + m[5] * p.y + m[9] * p.z + m[13];
+
+    res.z = m[2] * p.x + m[6] * p.y + m[10] * p.z + m[14];
+
+    return res;
+
+}
+
+
+
+// ----------------------------------------------------------
+
+// [  ĳ]   getSpherePoint  ̸   ǥ
+
+// ึ ĭ k  輱(k/N), 0.4, ߽(0.5), 0.6  -> 4N+1
+
+// ȭ  1/|p| (x, y) ϹǷ 6 ǥ ϳ  ,
+
+//  ȸ  ϹǷ planetRadius ٲ ٽ  ʿ 
+
+// [] 1/|p| ǥ stride^2 ũ N ũ (N = 2048̸ 268MB)  ʰ ȸ  
+
+// ----------------------------------------------------------
+
+enum { LAT_EDGE = 0, LAT_START = 1, LAT_CENTER = 2, LAT_END = 3 }; // ĭ  ġ
+
+
+
+struct SphereLattice {
+
+    int n = 0;                 // ǥ   N (0̸  )
+
+    int stride = 0;            //  ǥ  (4N + 1)
+
+    std::vector<float> axis;   // ǥ  ǥ (u - 0.5) * 2
+
+    std::vector<float> invLen; // stride x stride, 1 / sqrt(x^2 + y^2 + 1) (N ũ  )
+
+};
+
+const int LATTICE_TABLE_MAX_STRIDE = 1025; // N = 256 (4MB)
+
+SphereLattice lattice;
+
+
+
+inline int latIndex(int cell, int sub) { return cell * 4 + sub; }
+
+
+
+void buildSphereLattice() {
+
+    lattice.n = N;
+
+    lattice.stride = 4 * N + 1;
+
+    lattice.axis.assign(lattice.stride, 0.0f);
+
+
+
+    for (int k = 0; k <= N; k++) {
+
+        // Ʈ  / 浹 ڵ尡   ״ ( float  )
+
+        float u1 = (float)k / N; float u2 = (float)(k + 1) / N;
+
+        float cw = u2 - u1; float tw = cw * 0.2f;
+
+        float u[4] = { u1, u1 + (cw - tw) / 2.0f, (k + 0.5f) / N, u1 + (cw + tw) / 2.0f };
+
+        for (int j = 0; j < 4 && latIndex(k, j) < lattice.stride; j++)
+
+            lattice.axis[latIndex(k, j)] = (u[j] - 0.5f) * 2.0f;
+
+    }
+
+
+
+    lattice.invLen.clear();
+
+    if (lattice.stride > LATTICE_TABLE_MAX_STRIDE) return;
+
+    lattice.invLen.assign((size_t)lattice.stride * lattice.stride, 0.0f);
+
+    for (int iv = 0; iv < lattice.stride; iv++) {
+
+        for (int iu = 0; iu < lattice.stride; iu++) {
+
+            float x = lattice.axis[iu], y = lattice.axis[iv];
+
+            lattice.invLen[(size_t)iv * lattice.stride + iu] = 1.0f / sqrt(x * x + y * y + 1.0f);
+
+        }
+
+    }
+
+}
+
+
+
+void ensureSphereLattice() {
+
+    if (lattice.n != N) buildSphereLattice();
+
+}
+
+
+
+// getSpherePoint(face, u, v, r)   (sqrt  )
+
+// []   getSpherePoint  CubeTopology.h CUBE_FRAMES
+
+Point3D latticePoint(int face, int iu, int iv, float r) {
+
+    float ax = lattice.axis[iu], ay = lattice.axis[iv];
+
+    float s = lattice.invLen.empty() ? r / sqrt(ax * ax + ay * ay + 1.0f) : lattice.invLen[(size_t)iv * lattice.stride + iu] * r;
+
+    return cubeFacePoint<Point3D>(face, ax * s, ay * s, s);
+
+}
+
+
+
+// ----------------------------------------------------------
+
+// [CPU ] GL   켱(column-major) 4x4 
+
+// ø  GL ¸ ٽ  ʰ ϱ  
+
+// ----------------------------------------------------------
+
+void mat4Multiply(const float* a, const float* b, float* out) {
+
+    float res[16];
+
+    for (int col = 0; col < 4; col++) {
+
+        for (int row = 0; row < 4; row++) {
+
+            res[col * 4 + row] = a[row] * b[col * 4] + a[4 + row] * b[col * 4 + 1]
+
+                + a[8 + row] * b[col * 4 + 2] + a[12 + row] * b[col * 4 + 3];
+
+        }
+
+    }
+
+    for (int i = 0; i < 16; i++) out[i] = res[i];
+
+}
+
+
+
+// gluPerspective  
+
+void mat4Perspective(float fovY, float aspect, float zNear, float zFar, float* out) {
+
+    float f = 1.0f / tan(fovY * M_PI / 360.0f);
+
+    for (int i = 0; i < 16; i++) out[i] = 0.0f;
+
+    out[0] = f / aspect; out[5] = f;
+
+    out[10] = (zFar + zNear) / (zNear - zFar); out[11] = -1.0f;
+
+    out[14] = 2.0f * zFar * zNear / (zNear - zFar);
+
+}
+
+
+
+// gluLookAt  
+
+void mat4LookAt(Point3D eye, Point3D center, Point3D up, float* out) {
+
+    Point3D f = normalize({ center.x - eye.x, center.y - eye.y, center.z - eye.z });
+
+    Point3D s = normalize({ f.y * up.z - f.z * up.y, f.z * up.x - f.x * up.z, f.x * up.y - f.y * up.x });
+
+    Point3D u = { s.y * f.z - s.z * f.y, s.z * f.x - s.x * f.z, s.x * f.y - s.y * f.x };
+
+    out[0] = s.x; out[4] = s.y; out[8] = s.z;
+
+    out[1] = u.x; out[5] = u.y; out[9] = u.z;
+
+    out[2] = -f.x; out[6] = -f.y; out[10] = -f.z;
+
+    out[3] = 0.0f; out[7] = 0.0f; out[11] = 0.0f;
+
+    out[12] = -(s.x * eye.x + s.y * eye.y + s.z * eye.z);
+
+    out[13] = -(u.x * eye.x + u.y * eye.y + u.z * eye.z);
+
+    out[14] = f.x * eye.x + f.y * eye.y + f.z * eye.z;
+
+    out[15] = 1.0f;
+
+}
+
+
+
+// glRotatef(deg, 0, 1, 0)  
+
+void mat4RotateY(float deg, float* out) {
+
+    float a = deg * M_PI / 180.0f;
+
+    for (int i = 0; i < 16; i++) out[i] = (i % 5 == 0) ? 1.0f : 0.0f;
+
+    out[0] = cos(a); out[8] = sin(a);
+
+    out[2] = -sin(a); out[10] = cos(a);
+
+}
+
+
+
+// glRotatef(deg, x, y, z)   ( ̰ 0̸  )
+
+void mat4Rotate(float deg, float x, float y, float z, float* out) {
+
+    for (int i = 0; i < 16; i++) out[i] = (i % 5 == 0) ? 1.0f : 0.0f;
+
+    float len = sqrt(x * x + y * y + z * z);
+
+    if (len == 0.0f) return;
+
+    x /= len; y /= len; z /= len;
+
+    float a = deg * M_PI / 180.0f, c = cos(a), s = sin(a), t = 1.0f - c;
+
+    out[0] = t * x * x + c;     out[4] = t * x * y - s * z; out[8] = t * x * z + s * y;
+
+    out[1] = t * x * y + s * z; out[5] = t * y * y + c;     out[9] = t * y * z - s * x;
+
+    out[2] = t * x * z - s * y; out[6] = t * y * z + s * x; out[10] = t * z * z + c;
+
+}
+
+
+
+// glTranslatef / glScalef  
+
+void mat4Translate(float x, float y, float z, float* out) {
+
+    for (int i = 0; i < 16; i++) out[i] = (i % 5 == 0) ? 1.0f : 0.0f;
+
+    out[12] = x; out[13] = y; out[14] = z;
+
+}
+
+
+
+void mat4Scale(float x, float y, float z, float* out) {
+
+    for (int i = 0; i < 16; i++) out[i] = 0.0f;
+
+    out[0] = x; out[5] = y; out[10] = z; out[15] = 1.0f;
+
+}
+
+
+
+// ----------------------------------------------------------
+
+// [ü ø]  *  * (༺ ȸ) Ŀ  ̾Ƴ
+
+//  ı Ƿ  ༺  ǥ -> ûũ 踦 ȯ ʿ 
+
+// (÷̾  ʿ ־ 򼱿  κ Ƿ ü ˻)
+
+// ----------------------------------------------------------
+
+void setCullFrustum(const float* proj, const float* view, const float* model) {
+
+    float pv[16], m[16];
+
+    mat4Multiply(proj, view, pv);
+
+    mat4Multiply(pv, model, m);
+
+    for (int i = 0; i < 3; i++) {
+
+        for (int k = 0; k < 2; k++) {
+
+            float sign = (k == 0) ? 1.0f : -1.0f; // /, Ʒ/, /
+
+            float* pl = cullFrustum.planes[i * 2 + k];
+
+            for (int j = 0; j < 4; j++) pl[j] = m[j * 4 + 3] + sign * m[j * 4 + i];
+
+            float len = sqrt(pl[0] * pl[0] + pl[1] * pl[1] + pl[2] * pl[2]);
+
+            for (int j = 0; j < 4; j++) pl[j] /= len;
+
+        }
+
+    }
+
+}
+
+
+
+bool sphereInFrustum(Point3D c, float radius) {
+
+    if (!cullingEnabled) return true;
+
+    for (int i = 0; i < 6; i++) {
+
+        const float* pl = cullFrustum.planes[i];
+
+        if (pl[0] * c.x + pl[1] * c.y + pl[2] * c.z + pl[3] < -radius) return false;
+
+    }
+
+    return true;
+
+}
+
+
+
+// ----------------------------------------------------------
+
+// [ ε ]  ġ ȭ (  üũ ߰)
+
+//  ְų, оµ (Face)  0  
+
+// ----------------------------------------------------------
+
+void loadModel(const char* filename) {
+
+    FILE* fp = fopen(filename, "r");
+
+
+
+    // 1.  ü  
+
+    if (!fp) {
+
+        if (!models.empty()) {
+
+            models.push_back(models[0]); // 0  
+
+            // ( 縸 )
+
+        }
+
+        else {
+
+            Model m; models.push_back(m); // ־   
+
+        }
+
+        return;
+
+    }
+
+
+
+    Model m;
+
+    char buf[128]; int numV = 0, numF = 0;
+
+
+
+    //  б õ
+
+    if (fscanf(fp, "%s %s %d", buf, buf, &numV) != 3) numV = 0;
+
+
+
+    for (int i = 0; i < numV; i++) {
+
+        Point3D p;
+
+        if (fscanf(fp, "%f %f %f", &p.x, &p.y, &p.z) == 3) m.vertices.push_back(p);
+
+    }
+
+
+
+    if (fscanf(fp, "%s %s %d", buf, buf, &numF) != 3) numF = 0;
+
+
+
+    for (int i = 0; i < numF; i++) {
+
+        Face f;
+
+        if (fscanf(fp, "%d %d %d", &f.v1, &f.v2, &f.v3) == 3) m.faces.push_back(f);
+
+    }
+
+    fclose(fp);
+
+
+
+    // [߰]  ⼭    (  calculateNormal  )
+
+    buildModelNormals(m.vertices, m.faces, modelCreaseAngle, m.faceNormals, m.vertexNormals, m.cornerNormals);
+
+
+
+    // 2. [ٽ ]  ־, 빰 ν  (̳  )
+
+    //  쿡     0  ؼ ϴ.
+
+    if ((m.vertices.empty() || m.faces.empty()) && !models.empty()) {
+
+        models.push_back(models[0]);
+
+        std::cout << "Warning: " << filename << " is invalid (No data). Copied default model." << std::endl;
+
+    }
+
+    else {
+
+        models.push_back(m);
+
+        std::cout << "Model Loaded: " << filename << " (V: " << numV << ", F: " << numF << ")" << std::endl;
+
+    }
+
+}
+
+
+
+// ----------------------------------------------------------
+
+// [ ]  drawScene   ϴ     ؼ 
+
+// []  ڸ s  ĭ ġ  ä
+
+// ----------------------------------------------------------
+
+void computeItemMatrix(int s) {
+
+    // 1. [ ] (80)  ༭    
+
+    //     ̰(-), Ĺ  ø.
+
+    float heightOffset = -2.0f;
+
+    Point3D center = latticePoint(items.face[s], latIndex(items.col[s], LAT_CENTER), latIndex(items.row[s], LAT_CENTER), planetRadius + heightOffset);
+
+    items.posX[s] = center.x; items.posY[s] = center.y; items.posZ[s] = center.z;
+
+
+
+    // 2. [ȸ:  ]  Z(0,0,1)  ǥ (center) ġ
+
+    Point3D modelUp = { 0, 0, 1 };
+
+    Point3D surfNormal = normalize(center);
+
+    Point3D axis = {
+
+        modelUp.y * surfNormal.z - modelUp.z * surfNormal.y,
+
+        modelUp.z * surfNormal.x - modelUp.x * surfNormal.z,
+
+        modelUp.x * surfNormal.y - modelUp.y * surfNormal.x
+
+    };
+
+    float dot = modelUp.x * surfNormal.x + modelUp.y * surfNormal.y + modelUp.z * surfNormal.z;
+
+    float angleDeg = acos(dot) * 180.0f / M_PI;
+
+
+
+    // 3. ̵ *  *   (X -90) * ũ ( glTranslatef/glRotatef/glScalef  ״)
+
+    float t[16], r[16], fix[16], sc[16];
+
+    float* m = &items.transform[(size_t)s * 16];
+
+    mat4Translate(center.x, center.y, center.z, t);
+
+    mat4Rotate(angleDeg, axis.x, axis.y, axis.z, r);
+
+    mat4Rotate(-90, 1, 0, 0, fix);
+
+    mat4Scale(0.005f, 0.005f, 0.005f, sc);
+
+    mat4Multiply(t, r, m);
+
+    mat4Multiply(m, fix, m);
+
+    mat4Multiply(m, sc, m);
+
+}
+
+
+
+// ----------------------------------------------------------
+
+// [ ε] ε    𼭸  ÷ Ʈ  (initMap 𵨸  )
+
+// ----------------------------------------------------------
+
+void uploadModel(Model& m) {
+
+    if (m.list == 0) m.list = glGenLists(1);
+
+    glNewList(m.list, GL_COMPILE);
+
+    glBegin(GL_TRIANGLES);
+
+    for (size_t i = 0; i < m.faces.size(); i++) {
+
+        const Face& fc = m.faces[i];
+
+        int idx[3] = { fc.v1, fc.v2, fc.v3 };
+
+        for (int k = 0; k < 3; k++) {
+
+            Point3D n = m.cornerNormals[i * 3 + k], p = m.vertices[idx[k]];
+
+            glNormal3f(n.x, n.y, n.z); glVertex3f(p.x, p.y, p.z);
+
+        }
+
+    }
+
+    glEnd();
+
+    glEndList();
+
+}
+
+
+
+// ----------------------------------------------------------
+
+// [CSV ε] 0, 1   
+
+// 6  ʸ  (GL  Ƿ CubePlanetBench )
+
+// [] 6   а  ū ũ⸦ N  , / ĳ/ûũ  ű⿡ 
+
+// ----------------------------------------------------------
+
+void loadMapFaces() {
+
+    GridCSV csv[6];
+
+    int size = 0;
+
+    for (int i = 0; i < 6; i++) {
+
+        std::string filename = mapPrefix + CUBE_FACE_NAMES[i] + ".csv";
+
+        if (!csv[i].read(filename.c_str())) continue;
+
+        if (csv[i].rows > size) size = csv[i].rows;
+
+        if (csv[i].cols > size) size = csv[i].cols;
+
+        std::cout << "Map Loaded: " << filename << " (" << csv[i].rows << " x " << csv[i].cols << ")" << std::endl;
+
+    }
+
+    if (size == 0) size = BASE_N; //   ϳ   ༺
+
+
+
+    N = size;
+
+    grid.resize(N);
+
+    for (int f = 0; f < 6; f++) grid.placeCSV(f, csv[f], CUBE_CSV_ANGLES[f], true); // 0, 1 
+
+    grid.fillHalo(); // [߰]  ׵θ ̿   
+
+    rebuildWallBits();
+
+
+
+    planetRadius = BASE_RADIUS * N / BASE_N;
+
+    ensureSphereLattice();
+
+    resizeWallChunks();
+
+
+
+    // [߰]    ã ׷  (ĭ ׷ θ Ѹ, ū ༺  ׷ initMap   )
+
+    mazeGraph = MazeGraph(); pathFinder = PathFinder(); hierPath = HierPath();
+
+    invalidateMazeGraph();
+
+}
+
+
+
+// [߰] items  ĭ  ٽ  (ֿ  )
+
+// []   id (ڸ ֿ  ٲ), ֿ id ƹ ĭ ־ٰ ٷ 
+
+void rebuildItemIndex() {
+
+    std::vector<CubeCell> cells(items.idCount(), CubeCell{ 0, 0, 0 });
+
+    items.forEach([&](int s) { cells[items.entityAt[s]] = { items.face[s], items.row[s], items.col[s] }; });
+
+    itemIndex.build(N, cells);
+
+    for (int id = 0; id < items.idCount(); id++) if (!items.alive(id)) itemIndex.remove(id);
+
+}
+
+
+
+// [߰]   ֿ (Ҵ  ְ   )
+
+bool missionComplete() {
+
+    return items.idCount() > 0 && items.size() == 0;
+
+}
+
+
+
+// [߰]  ĭ ׷   ٽ  (ĭ  getSpherePoint)
+
+void buildMazeGraph() {
+
+    mazeGraph.build(N, [](int f, int r, int c) { return wallBits.isWall(f, r, c); },
+
+        [](int f, int r, int c) { return getSpherePoint(f, (c + 0.5f) / N, (r + 0.5f) / N, 1.0f); });
+
+    pathFinder.prepare(mazeGraph);
+
+    mazeGraphDirty = false;
+
+}
+
+
+
+// [߰]  ٲ: ׷    ٽ   δ 
+
+void invalidateMazeGraph() {
+
+    mazeGraphDirty = true;
+
+    itemRoute.clear(); itemRouteCost = 0.0f;
+
+    itemRouteFrom = itemRouteItems = -1;
+
+}
+
+
+
+// [߰] ū ༺ Ŭ  ׷    (    setMapCell  Ŭ͸ ħ)
+
+// [] Ŭ /   agentJobs ϲ۵鿡  (ϲ  ȥ)
+
+void buildHierPath() {
+
+    hierPath.build(N, [](int f, int r, int c) { return wallBits.isWall(f, r, c); }, &agentJobs);
+
+    hierPath.weight = HIER_PATH_WEIGHT;
+
+}
+
+
+
+// ----------------------------------------------------------
+
+// [ʱȭ] 6  ε   ġ
+
+// ----------------------------------------------------------
+
+void initMap() {
+
+    loadMapFaces();
+
+
+
+    // []  ε (myModel.dat + model_1~5.dat)
+
+    for (Model& m : models) if (m.list != 0) glDeleteLists(m.list, 1);
+
+    models.clear();
+
+    loadModel("myModel.dat"); // 0  (⺻)
+
+    for (int i = 1; i < 7; i++) {
+
+        char filename[64];
+
+        sprintf(filename, "model_%d.dat", i);
+
+        loadModel(filename);
+
+    }
+
+    for (Model& m : models) uploadModel(m); // [߰]   ⼭   ÷ Ʈ (׸ ߿ ø )
+
+
+
+    //  ġ
+
+    items.clear();
+
+    float colors[6][3] = {
+
+        {1.0f, 0.0f, 0.0f}, {0.0f, 1.0f, 0.0f}, {0.0f, 0.0f, 1.0f},
+
+        {1.0f, 1.0f, 0.0f}, {1.0f, 0.0f, 1.0f}, {0.0f, 1.0f, 1.0f}
+
+    };
+
+
+
+    for (int f = 0; f < 6; f++) {
+
+        // ε  ŭ ȯؼ Ҵ []     (Ұ 𵨺  )
+
+        int modelIndex = models.empty() ? 0 : f % (int)models.size();
+
+        int s = items.slot(items.create(modelIndex));
+
+        items.face[s] = f;
+
+        items.row[s] = N / 2; items.col[s] = N / 2;
+
+        items.rotation[s] = 0.0f;
+
+
+
+        items.colorR[s] = colors[f][0]; items.colorG[s] = colors[f][1]; items.colorB[s] = colors[f][2];
+
+        computeItemMatrix(s);
+
+
+
+        setMapCell(f, N / 2, N / 2, 0); //  ڸ   []  Ʈ / Ÿ嵵  ĭ ѷ ħ
+
+    }
+
+    totalItems = items.size();
+
+    printf("Total Items: %d\n", totalItems);
+
+    rebuildItemIndex(); // [߰]
+
+    // [߰] ū ༺  ڸ    ׷ ⼭  (ó 'R'  ӿ  ʰ)
+
+    if (N >= HIER_PATH_MIN_N) buildHierPath();
+
+
+
+    // [߰]  ڸ     ޽ ̸  ( ã ׷ 'R' θ   )
+
+    markAllWallChunksDirty();
+
+    sceneVersion++;
+
+    if (N <= EAGER_BAKE_MAX_N) bakeWallMesh(); // ū ༺ ̴ ûũ drawWallMesh 
+
+    bakeFloorMesh();
+
+}
+
+
+
+// ----------------------------------------------------------
+
+// [̿ üũ] (   )
+
+// ----------------------------------------------------------
+
+// [] 鸶   б  CubeTopology.h   ǥ ( ⿡   )
+
+//   ũ(N = 15)     ĭ ǥ ٷ а,   N   
+
+void resolveNeighbor(int f, int r, int c, int& targetF, int& tr, int& tc) {
+
+    CubeCell t = (N == BASE_N) ? cubeSeamCellN<BASE_N>(f, r, c) : cubeSeamCell(f, r, c, N);
+
+    targetF = t.f; tr = t.r; tc = t.c;
+
+}
+
+
+
+// []    ĭ(-1, N) grid ׵θ ̿    Ƿ ٷ  (б )
+
+// ׵θ  ҷų ĥ  resolveNeighbor Ģ ä
+
+int getNeighborValue(int f, int r, int c) {
+
+    return grid.at(f, r, c);
+
+}
+
+
+
+// ----------------------------------------------------------
+
+// [ Ʈ] ڿ  Ʈ ̰ 6  Ʈ 
+
+//   ʸ ̿ getNeighborValue (鸶 4Nĭ),   
+
+// []  Ÿ嵵  ٽ 
+
+// ----------------------------------------------------------
+
+bool outsideWall(int f, int r, int c) { return getNeighborValue(f, r, c) == 1; }
+
+
+
+void rebuildWallBits() {
+
+    wallBits.fromGrid(grid, 1);
+
+    for (int f = 0; f < 6; f++) wallBits.computeRows(f, 0, N, outsideWall);
+
+    wallDistance.build(wallBits);
+
+}
+
+
+
+// ----------------------------------------------------------
+
+// [ Ÿ] ༺  ǥ     Ÿ ( , ִ  16ĭ)
+
+// Ÿ ĭ   ڸ ĭ ũ⸦  ( ǥ x, y   ĭ )
+
+// ̵ ӵ / AI ȸ / ī޶ ⿡  O(1) ȸ
+
+// ----------------------------------------------------------
+
+float wallClearance(Point3D local) {
+
+    int f;
+
+    float x, y;
+
+    cubeFaceCoords(local, f, x, y);
+
+    float cellsAway = wallDistance.sample(f, x, y);
+
+
+
+    // p = (x, y, 1) / |.|  x, y ̺   * ĭ ϳ  ǥ  (2 / N)
+
+    float q = 1.0f + x * x + y * y;
+
+    float cellWidth = planetRadius * (2.0f / N) * 0.5f * (sqrt(1.0f + y * y) + sqrt(1.0f + x * x)) / q;
+
+    return cellsAway * cellWidth;
+
+}
+
+
+
+// q = ༺ ȸ (⺻  ȸ, ̵ ĺε )
+
+Point3D playerLocalPosition(const Quat& q = planetOrientation) {
+
+    Point3D playerPos = { 0.0f, -planetRadius + 1.5f, 0.0f };
+
+    return q.applyInverse(playerPos);
+
+}
+
+
+
+// ----------------------------------------------------------
+
+// [ ޽]     Helper
+
+//  drawWallSegment  //ؽó ǥ ۿ ״´
+
+// ----------------------------------------------------------
+
+void pushQuad(std::vector<MeshVertex>& out, Point3D a, Point3D b, Point3D c, Point3D d) {
+
+    Point3D n = calculateNormal(a, b, c);
+
+    float u0, v0, u1, v1; // [] Ʋ  Ÿ ǥ
+
+    atlasUV(TILE_WALL, 0, 0, u0, v0); atlasUV(TILE_WALL, 1, 1, u1, v1);
+
+    out.push_back({ u0, v0, n.x, n.y, n.z, a.x, a.y, a.z });
+
+    out.push_back({ u1, v0, n.x, n.y, n.z, b.x, b.y, b.z });
+
+    out.push_back({ u1, v1, n.x, n.y, n.z, c.x, c.y, c.z });
+
+    out.push_back({ u0, v1, n.x, n.y, n.z, d.x, d.y, d.z });
+
+}
+
+
+
+// []  ڿ ׸    ְ (̾    ̹Ƿ )
+
+enum { WALL_TOP = 1, WALL_SIDE_VS = 2, WALL_SIDE_UE = 4, WALL_SIDE_VE = 8, WALL_SIDE_US = 16, WALL_ALL = 31 };
+
+
+
+// u_s ~ v_e   ĳ ǥ ȣ (latIndex)
+
+void emitWallBox(std::vector<MeshVertex>& out, int f, int u_s, int u_e, int v_s, int v_e, int mask) {
+
+    float h = 6.0f; //  
+
+    Point3D p0 = latticePoint(f, u_s, v_s, planetRadius);
+
+    Point3D p1 = latticePoint(f, u_e, v_s, planetRadius);
+
+    Point3D p2 = latticePoint(f, u_e, v_e, planetRadius);
+
+    Point3D p3 = latticePoint(f, u_s, v_e, planetRadius);
+
+    Point3D p4 = latticePoint(f, u_s, v_s, planetRadius - h);
+
+    Point3D p5 = latticePoint(f, u_e, v_s, planetRadius - h);
+
+    Point3D p6 = latticePoint(f, u_e, v_e, planetRadius - h);
+
+    Point3D p7 = latticePoint(f, u_s, v_e, planetRadius - h);
+
+
+
+    if (mask & WALL_TOP) pushQuad(out, p4, p5, p6, p7); // 
+
+    if (mask & WALL_SIDE_VS) pushQuad(out, p0, p1, p5, p4); //  4
+
+    if (mask & WALL_SIDE_UE) pushQuad(out, p1, p2, p6, p5);
+
+    if (mask & WALL_SIDE_VE) pushQuad(out, p2, p3, p7, p6);
+
+    if (mask & WALL_SIDE_US) pushQuad(out, p3, p0, p4, p7);
+
+}
+
+
+
+// ----------------------------------------------------------
+
+// [ ޽ ġ]  ٷ ̾    ϳ
+
+// main  ǥ b0 ~ b1  ,   x0 ~ x1 ( )
+
+// ĭ  ĭ      (    ٴ ڸ )
+
+// sideLo / sideHi: main  ĭ ȣ  ĭ  鿡   پ  1 ->   
+
+// ----------------------------------------------------------
+
+void emitWallRun(std::vector<MeshVertex>& out, int f, bool alongU, int b0, int b1, int x0, int x1,
+
+    const char* sideLo, const char* sideHi) {
+
+    std::vector<int> brk;
+
+    for (int k = b0; k <= b1; k++) {
+
+        int cell = k / 4, sub = k % 4;
+
+        bool attached = (sideLo && sideLo[cell]) || (sideHi && sideHi[cell]);
+
+        if (k == b0 || k == b1 || sub == LAT_EDGE || sub == LAT_CENTER || attached) brk.push_back(k);
+
+    }
+
+
+
+    //  ĭ  ̿ ĭ  ̾ Ƿ,  (ݴ)    Ƿ  
+
+    bool capStart = (b0 % 4 == LAT_START), capEnd = (b1 % 4 == LAT_END);
+
+    int last = (int)brk.size() - 2;
+
+    for (int i = 0; i <= last; i++) {
+
+        int a = brk[i], b = brk[i + 1], cell = a / 4;
+
+        bool inPost = a >= latIndex(cell, LAT_START) && b <= latIndex(cell, LAT_END);
+
+        bool hideLo = inPost && sideLo && sideLo[cell];
+
+        bool hideHi = inPost && sideHi && sideHi[cell];
+
+
+
+        int mask = WALL_TOP;
+
+        if (alongU) {
+
+            if (!hideLo) mask |= WALL_SIDE_VS;
+
+            if (!hideHi) mask |= WALL_SIDE_VE;
+
+            if (i == 0 && capStart) mask |= WALL_SIDE_US;
+
+            if (i == last && capEnd) mask |= WALL_SIDE_UE;
+
+            emitWallBox(out, f, a, b, x0, x1, mask);
+
+        }
+
+        else {
+
+            if (!hideLo) mask |= WALL_SIDE_US;
+
+            if (!hideHi) mask |= WALL_SIDE_UE;
+
+            if (i == 0 && capStart) mask |= WALL_SIDE_VS;
+
+            if (i == last && capEnd) mask |= WALL_SIDE_VE;
+
+            emitWallBox(out, f, x0, x1, a, b, mask);
+
+        }
+
+    }
+
+}
+
+
+
+// ûũ ϳ ( f,  r0 ~ r1,  c0 ~ c1)     /  ٷ ļ 
+
+//  η  ĭ̸  , ƴϸ    (ġ  )
+
+void emitMergedWalls(std::vector<MeshVertex>& out, int f, int r0, int r1, int c0, int c1) {
+
+    struct CellConn { bool wall, L, R, U, D; };
+
+    std::vector<CellConn> conn((r1 - r0) * (c1 - c0));
+
+    auto at = [&](int r, int c) -> CellConn& { return conn[(r - r0) * (c1 - c0) + (c - c0)]; };
+
+    for (int r = r0; r < r1; r++) {
+
+        for (int c = c0; c < c1; c++) {
+
+            CellConn& cc = at(r, c);
+
+            int m = wallBits.mask(f, r, c); // [] ̸   Ʈ 
+
+            cc.wall = wallBits.isWall(f, r, c);
+
+            cc.L = (m & WallBits::CONN_L) != 0;
+
+            cc.R = (m & WallBits::CONN_R) != 0;
+
+            cc.U = (m & WallBits::CONN_U) != 0;
+
+            cc.D = (m & WallBits::CONN_D) != 0;
+
+        }
+
+    }
+
+
+
+    // 1.  : /Ʒ   ٴ ĭ  ڸ  
+
+    std::vector<char> sideU(N + 1, 0), sideD(N + 1, 0);
+
+    for (int r = r0; r < r1; r++) {
+
+        for (int c = c0; c < c1; c++) { sideU[c] = at(r, c).wall && at(r, c).U; sideD[c] = at(r, c).wall && at(r, c).D; }
+
+        int c = c0;
+
+        while (c < c1) {
+
+            const CellConn& first = at(r, c);
+
+            if (!first.wall || !(first.L || first.R)) { c++; continue; }
+
+            int cs = c;
+
+            while (c + 1 < c1 && at(r, c).R) c++; //  ̸  ĭ  (ûũ ȿ ̾)
+
+            int ce = c++;
+
+            int b0 = at(r, cs).L ? latIndex(cs, LAT_EDGE) : latIndex(cs, LAT_START);
+
+            int b1 = at(r, ce).R ? latIndex(ce + 1, LAT_EDGE) : latIndex(ce, LAT_END);
+
+            emitWallRun(out, f, true, b0, b1, latIndex(r, LAT_START), latIndex(r, LAT_END), sideU.data(), sideD.data());
+
+        }
+
+    }
+
+
+
+    // 2.  : /Ʒ  +      (  )
+
+    for (int c = c0; c < c1; c++) {
+
+        int r = r0;
+
+        while (r < r1) {
+
+            const CellConn& first = at(r, c);
+
+            bool horiz = first.L || first.R;
+
+            if (!first.wall || !(first.U || first.D || !horiz)) { r++; continue; }
+
+            int rs = r;
+
+            while (r + 1 < r1 && at(r, c).D) r++;
+
+            int re = r++;
+
+
+
+            // ̾  Ƽ  ϳ (    ڸ )
+
+            int boxS = -1, boxE = -1;
+
+            auto flush = [&]() {
+
+                if (boxS >= 0) emitWallRun(out, f, false, boxS, boxE, latIndex(c, LAT_START), latIndex(c, LAT_END), nullptr, nullptr);
+
+                boxS = -1;
+
+            };
+
+            auto add = [&](int a, int b) {
+
+                if (boxS >= 0 && boxE == a) boxE = b;
+
+                else { flush(); boxS = a; boxE = b; }
+
+            };
+
+            for (int rr = rs; rr <= re; rr++) {
+
+                const CellConn& cc = at(rr, c);
+
+                if (cc.U) add(latIndex(rr, LAT_EDGE), latIndex(rr, LAT_START));
+
+                if (!(cc.L || cc.R)) add(latIndex(rr, LAT_START), latIndex(rr, LAT_END));
+
+                if (cc.D) add(latIndex(rr, LAT_END), latIndex(rr + 1, LAT_EDGE));
+
+            }
+
+            flush();
+
+        }
+
+    }
+
+}
+
+
+
+// ----------------------------------------------------------
+
+// [ ޽ ûũ] ûũ ȣ <-> (, Ÿ , Ÿ )
+
+// ----------------------------------------------------------
+
+int chunkIdOf(int f, int r, int c) {
+
+    return (f * chunksPerSide + r / chunkSize) * chunksPerSide + c / chunkSize;
+
+}
+
+
+
+void markAllWallChunksDirty() {
+
+    for (int i = 0; i < chunkCount; i++) wallChunks[i].dirty = true;
+
+}
+
+
+
+// ----------------------------------------------------------
+
+// [ûũ  ] ûũ  ٴ/  ǥ  δ 
+
+// ǥ   Ǭ ŭ  ´
+
+// ----------------------------------------------------------
+
+void computeChunkBounds(int f, int r0, int r1, int c0, int c1, WallChunk& ch) {
+
+    const int S = 5;
+
+    Point3D pts[2 * S * S];
+
+    int count = 0;
+
+    Point3D sum = { 0, 0, 0 };
+
+    for (int i = 0; i < S; i++) {
+
+        for (int j = 0; j < S; j++) {
+
+            int iv = latIndex(r0 + (r1 - r0) * i / (S - 1), LAT_EDGE);
+
+            int iu = latIndex(c0 + (c1 - c0) * j / (S - 1), LAT_EDGE);
+
+            for (int k = 0; k < 2; k++) {
+
+                Point3D p = latticePoint(f, iu, iv, (k == 0) ? planetRadius : planetRadius - 6.0f);
+
+                pts[count++] = p;
+
+                sum.x += p.x; sum.y += p.y; sum.z += p.z;
+
+            }
+
+        }
+
+    }
+
+    ch.boundCenter = { sum.x / count, sum.y / count, sum.z / count };
+
+    float maxD2 = 0.0f;
+
+    for (int i = 0; i < count; i++) {
+
+        float dx = pts[i].x - ch.boundCenter.x, dy = pts[i].y - ch.boundCenter.y, dz = pts[i].z - ch.boundCenter.z;
+
+        if (dx * dx + dy * dy + dz * dz > maxD2) maxD2 = dx * dx + dy * dy + dz * dz;
+
+    }
+
+    ch.boundRadius = sqrt(maxD2) + planetRadius * 0.01f;
+
+}
+
+
+
+// ûũ 0 ~ chunkCount-1  (,  ,  )
+
+void chunkRect(int id, int& f, int& r0, int& r1, int& c0, int& c1) {
+
+    f = id / (chunksPerSide * chunksPerSide);
+
+    r0 = (id / chunksPerSide) % chunksPerSide * chunkSize;
+
+    c0 = id % chunksPerSide * chunkSize;
+
+    r1 = (r0 + chunkSize < N) ? r0 + chunkSize : N;
+
+    c1 = (c0 + chunkSize < N) ? c0 + chunkSize : N;
+
+}
+
+
+
+// [߰] N ٲ ûũ  ٽ    ̸   (  ø/浹 )
+
+// N ũ ûũ ũ  ûũ (= ø ˻, ÷ Ʈ ) 
+
+void resizeWallChunks() {
+
+    for (auto& ch : wallChunks) if (ch.list != 0) glDeleteLists(ch.list, 1);
+
+    chunkSize = (N <= 64) ? 8 : 32;
+
+    chunksPerSide = (N + chunkSize - 1) / chunkSize;
+
+    chunkCount = 6 * chunksPerSide * chunksPerSide;
+
+    wallChunks.assign(chunkCount, WallChunk());
+
+    wallQuadCount = 0;
+
+    bakedChunkCount = 0;
+
+
+
+    ensureSphereLattice();
+
+    for (int id = 0; id < chunkCount; id++) {
+
+        int f, r0, r1, c0, c1;
+
+        chunkRect(id, f, r0, r1, c0, c1);
+
+        computeChunkBounds(f, r0, r1, c0, c1, wallChunks[id]);
+
+    }
+
+
+
+    // [߰] ĭ    (浹 ˻ ),   ĭ  4    
+
+    cellBoundRadius = 0.0f;
+
+    int mid = N / 2;
+
+    Point3D center = latticePoint(FACE_BACK, latIndex(mid, LAT_CENTER), latIndex(mid, LAT_CENTER), planetRadius - 1.5f);
+
+    for (int k = 0; k < 4; k++) {
+
+        Point3D corner = latticePoint(FACE_BACK, latIndex(mid + (k & 1), LAT_EDGE), latIndex(mid + (k >> 1), LAT_EDGE), planetRadius - 1.5f);
+
+        float d = sqrt((corner.x - center.x) * (corner.x - center.x) + (corner.y - center.y) * (corner.y - center.y) + (corner.z - center.z) * (corner.z - center.z));
+
+        if (d > cellBoundRadius) cellBoundRadius = d;
+
+    }
+
+}
+
+
+
+// ----------------------------------------------------------
+
+// [ ޽ ] ûũ ϳ ͸ ۷  ÷ Ʈ ø
+
+// (GL 1.1  ־ VBO  ÷ Ʈ , ̹ ޸𸮿 )
+
+// ----------------------------------------------------------
+
+void bakeWallChunk(int id) {
+
+    int f, r0, r1, c0, c1;
+
+    chunkRect(id, f, r0, r1, c0, c1);
+
+
+
+    ensureSphereLattice();
+
+    std::vector<MeshVertex> verts;
+
+    emitMergedWalls(verts, f, r0, r1, c0, c1); // [] ĭ   ̾  
+
+
+
+    WallChunk& ch = wallChunks[id];
+
+    if (ch.list == 0) { ch.list = glGenLists(1); bakedChunkCount++; }
+
+    glNewList(ch.list, GL_COMPILE);
+
+    if (!verts.empty()) {
+
+        glInterleavedArrays(GL_T2F_N3F_V3F, 0, verts.data());
+
+        glDrawArrays(GL_QUADS, 0, (GLsizei)verts.size());
+
+    }
+
+    glEndList();
+
+    glDisableClientState(GL_TEXTURE_COORD_ARRAY);
+
+    glDisableClientState(GL_NORMAL_ARRAY);
+
+    glDisableClientState(GL_VERTEX_ARRAY);
+
+
+
+    wallQuadCount += (int)verts.size() / 4 - ch.quadCount;
+
+    ch.quadCount = (int)verts.size() / 4;
+
+    ch.dirty = false;
+
+}
+
+
+
+//  ûũ ٽ ´
+
+void bakeWallMesh() {
+
+    int rebuilt = 0;
+
+    for (int i = 0; i < chunkCount; i++) {
+
+        if (wallChunks[i].dirty) { bakeWallChunk(i); rebuilt++; }
+
+    }
+
+    if (rebuilt > 0) printf("Wall Mesh Baked: %d chunks rebuilt, %d quads total\n", rebuilt, wallQuadCount);
+
+}
+
+
+
+// ----------------------------------------------------------
+
+// [  API] ĭ ϳ ٲٰ ٽ   ûũ  
+
+// Ʈ  ¿ ̿ Ƿ ̿ ĭ ûũ (  ʸӱ) ȿȭ
+
+// ----------------------------------------------------------
+
+std::vector<int> setMapCell(int f, int r, int c, int val) {
+
+    std::vector<int> invalidated;
+
+    if (grid.at(f, r, c) == val) return invalidated;
+
+    grid.at(f, r, c) = val;
+
+    wallBits.set(f, r, c, val == 1);
+
+    if (r == 0 || r == N - 1 || c == 0 || c == N - 1) grid.fillHalo(); // ڸ ĭ ̿  ׵θ  
+
+    wallDistance.update(wallBits, f, r, c); // [߰] Ÿ   ĭ ٽ 
+
+    invalidateMazeGraph(); // [߰]
+
+    if (hierPath.n == N) hierPath.update(f, r, c, val == 1); // [߰]  ׷  Ŭ͸ ٽ 
+
+    sceneVersion++;
+
+
+
+    const int dr[5] = { 0, 0, 0, -1, 1 };
+
+    const int dc[5] = { 0, -1, 1, 0, 0 };
+
+    for (int i = 0; i < 5; i++) {
+
+        int tf, tr, tc;
+
+        resolveNeighbor(f, r + dr[i], c + dc[i], tf, tr, tc);
+
+        wallBits.computeRows(tf, tr, tr + 1, outsideWall); // ̿ ĭ ִ   Ʈ ٽ 
+
+        int id = chunkIdOf(tf, tr, tc);
+
+        bool seen = false;
+
+        for (int k : invalidated) if (k == id) seen = true;
+
+        if (!seen) { invalidated.push_back(id); wallChunks[id].dirty = true; }
+
+    }
+
+    return invalidated;
+
+}
+
+
+
+// ----------------------------------------------------------
+
+// [ٴ ޽] gluSphere  getSpherePoint     (  )
+
+// ؽó ǥ ĭ ϳ = üũ   ĭ ǵ Ƽ  ڿ 
+
+// ----------------------------------------------------------
+
+// [] ٴ ĭ (floorN) N ٸ  ־  ĳ   ǥ (u, v) 
+
+void pushFloorVertex(std::vector<MeshVertex>& out, int f, float fu, float fv, float s, float t) {
+
+    Point3D p = getSpherePoint(f, fu, fv, planetRadius);
+
+    Point3D n = getSpherePoint(f, fu, fv, -1.0f); // (߽)   
+
+    float u, v; atlasUV(TILE_FLOOR, s, t, u, v);
+
+    out.push_back({ u, v, n.x, n.y, n.z, p.x, p.y, p.z });
+
+}
+
+
+
+void bakeFloorMesh() {
+
+    std::vector<MeshVertex> verts;
+
+    const float texPerCell = 0.125f; // 64px ؽó 8px üũ  ĭ
+
+    int floorN = (N < FLOOR_MAX_CELLS) ? N : FLOOR_MAX_CELLS;
+
+
+
+    for (int f = 0; f < 6; f++) {
+
+        for (int r = 0; r < floorN; r++) {
+
+            for (int c = 0; c < floorN; c++) {
+
+                // ĭ -߽- 2
+
+                float us[3] = { (float)c / floorN, (c + 0.5f) / floorN, (float)(c + 1) / floorN };
+
+                float vs[3] = { (float)r / floorN, (r + 0.5f) / floorN, (float)(r + 1) / floorN };
+
+                for (int i = 0; i < 2; i++) {
+
+                    for (int j = 0; j < 2; j++) {
+
+                        // [] Ʋ󽺿 ݺ(REPEAT)  Ƿ Ÿ  ǥ(0~1) 
+
+                        // 簢 ϳ 1/16 Ÿ̶  Ÿ 踦  
+
+                        float s0 = (c + j * 0.5f) * texPerCell, t0 = (r + i * 0.5f) * texPerCell;
+
+                        s0 -= floor(s0); t0 -= floor(t0);
+
+                        float s1 = s0 + 0.5f * texPerCell, t1 = t0 + 0.5f * texPerCell;
+
+                        Point3D a = getSpherePoint(f, us[j], vs[i], planetRadius);
+
+                        Point3D b = getSpherePoint(f, us[j + 1], vs[i], planetRadius);
+
+                        Point3D d = getSpherePoint(f, us[j + 1], vs[i + 1], planetRadius);
+
+                        //     (    ʰ)
+
+                        Point3D n = calculateNormal(a, b, d);
+
+                        if (n.x * a.x + n.y * a.y + n.z * a.z < 0) {
+
+                            pushFloorVertex(verts, f, us[j], vs[i], s0, t0);
+
+                            pushFloorVertex(verts, f, us[j + 1], vs[i], s1, t0);
+
+                            pushFloorVertex(verts, f, us[j + 1], vs[i + 1], s1, t1);
+
+                            pushFloorVertex(verts, f, us[j], vs[i + 1], s0, t1);
+
+                        }
+
+                        else {
+
+                            pushFloorVertex(verts, f, us[j], vs[i], s0, t0);
+
+                            pushFloorVertex(verts, f, us[j], vs[i + 1], s0, t1);
+
+                            pushFloorVertex(verts, f, us[j + 1], vs[i + 1], s1, t1);
+
+                            pushFloorVertex(verts, f, us[j + 1], vs[i], s1, t0);
+
+                        }
+
+                    }
+
+                }
+
+            }
+
+        }
+
+    }
+
+
+
+    if (floorList == 0) floorList = glGenLists(1);
+
+    glNewList(floorList, GL_COMPILE);
+
+    glInterleavedArrays(GL_T2F_N3F_V3F, 0, verts.data());
+
+    glDrawArrays(GL_QUADS, 0, (GLsizei)verts.size());
+
+    glEndList();
+
+    glDisableClientState(GL_TEXTURE_COORD_ARRAY);
+
+    glDisableClientState(GL_NORMAL_ARRAY);
+
+    glDisableClientState(GL_VERTEX_ARRAY);
+
+
+
+    floorBuiltN = N;
+
+    floorBuiltRadius = planetRadius;
+
+    printf("Floor Mesh Baked: %d quads\n", (int)verts.size() / 4);
+
+}
+
+
+
+void drawFloorMesh() {
+
+    if (floorBuiltN != N || floorBuiltRadius != planetRadius) bakeFloorMesh();
+
+
+
+    setTexturing(true); bindTexture(texAtlas);
+
+    glColor3f(0.7f, 0.7f, 0.8f);
+
+    glCallList(floorList);
+
+}
+
+
+
+// [߰]   ׸ ûũ Ʈ   ûũ  MAX_BAKED_CHUNKS Ʒ 
+
+void evictWallChunks() {
+
+    if (bakedChunkCount <= MAX_BAKED_CHUNKS) return;
+
+    for (auto& ch : wallChunks) {
+
+        if (ch.list == 0 || frameCounter - ch.lastDrawnFrame < EVICT_AFTER_FRAMES) continue;
+
+        glDeleteLists(ch.list, 1);
+
+        ch.list = 0; bakedChunkCount--;
+
+        wallQuadCount -= ch.quadCount; ch.quadCount = 0;
+
+        ch.dirty = true; // ٽ ̸  
+
+    }
+
+}
+
+
+
+void drawWallMesh() {
+
+    // [] ̴ ûũ   ͸ Ӵ BAKE_BUDGET_PER_FRAME 
+
+
+
+    setTexturing(true); bindTexture(texAtlas); // ٴڰ  Ʋ󽺶  ε 
+
+    GLfloat white[] = { 1,1,1,1 }, black[] = { 0,0,0,1 };
+
+    setMaterial(white, black, 0);
+
+    for (int i = 0; i < chunkCount; i++) {
+
+        WallChunk& ch = wallChunks[i];
+
+        if (!ch.dirty && ch.quadCount == 0) continue;
+
+        if (!sphereInFrustum(ch.boundCenter, ch.boundRadius)) { cullStats.chunksCulled++; continue; }
+
+        if (ch.dirty && bakesThisFrame < BAKE_BUDGET_PER_FRAME) { bakeWallChunk(i); bakesThisFrame++; }
+
+        ch.lastDrawnFrame = frameCounter;
+
+        if (ch.list == 0 || ch.quadCount == 0) continue; //    ûũ ( ӿ)
+
+        cullStats.chunksDrawn++;
+
+        glCallList(ch.list);
+
+    }
+
+}
+
+
+
+// [߰] ÷̾ ĭ ̷θ     ۱  ( ĭ̳    ٲ  ٽ ã)
+
+// []      ROUTE_CANDIDATES   ̷ ΰ  ª ͱ
+
+void updateItemRoute() {
+
+    int f, r, c;
+
+    cubeCellOf(playerLocalPosition(), N, f, r, c);
+
+    int start = (f * N + r) * N + c;
+
+    if (start == itemRouteFrom && items.size() == itemRouteItems) return;
+
+    itemRouteFrom = start; itemRouteItems = items.size();
+
+    itemRoute.clear(); itemRouteCost = 0.0f;
+
+
+
+    Point3D foot = playerLocalPosition();
+
+    std::vector<std::pair<float, int>> candidates; // ( Ÿ , ڸ)
+
+    items.forEach([&](int s) {
+
+        Point3D d = { items.posX[s] - foot.x, items.posY[s] - foot.y, items.posZ[s] - foot.z };
+
+        candidates.push_back({ vec3Dot(d, d), s });
+
+    });
+
+    if (candidates.empty()) return;
+
+    size_t keep = std::min(candidates.size(), (size_t)ROUTE_CANDIDATES);
+
+    std::partial_sort(candidates.begin(), candidates.begin() + keep, candidates.end());
+
+    candidates.resize(keep);
+
+
+
+    // [߰] ū ༺: ĺ HPA*   븸   ª  ϳ ĭ η ħ
+
+    //   ĭ    Ÿ ̶  ĭ   Ÿ    -> ׺  ĺ ǳʶ
+
+    // [] ĭ ׷ ü  ,  ׷ initMap  
+
+    if (N >= HIER_PATH_MIN_N) {
+
+        if (hierPath.n != N) return;
+
+        CubeCell from = { f, r, c }, goal = { 0, 0, 0 };
+
+        float bestCost = 1e30f, cost, fromPoint[3], itemPoint[3];
+
+        hierPath.center(f, r, c, fromPoint);
+
+        itemRouteExpanded = 0;
+
+        for (const auto& e : candidates) {
+
+            CubeCell p = { items.face[e.second], items.row[e.second], items.col[e.second] };
+
+            hierPath.center(p.f, p.r, p.c, itemPoint);
+
+            if (HierPath::chord(fromPoint, itemPoint) >= bestCost) continue;
+
+            if (hierPath.route(from, p, itemRoute, cost, false) && cost < bestCost) { bestCost = cost; goal = p; }
+
+            itemRouteExpanded += hierPath.expanded;
+
+        }
+
+        if (bestCost >= 1e30f) return;
+
+        hierPath.route(from, goal, itemRoute, itemRouteCost);
+
+        itemRouteExpanded += hierPath.expanded;
+
+        return;
+
+    }
+
+
+
+    // ǥ  ̹Ƿ ޸ƽ =   ĺ  
+
+    if (mazeGraphDirty) buildMazeGraph();
+
+    std::vector<float> goals;
+
+    std::vector<int> goalNodes;
+
+    for (const auto& e : candidates) {
+
+        Point3D p = normalize(Point3D{ items.posX[e.second], items.posY[e.second], items.posZ[e.second] });
+
+        goals.push_back(p.x); goals.push_back(p.y); goals.push_back(p.z);
+
+        goalNodes.push_back(mazeGraph.node(items.face[e.second], items.row[e.second], items.col[e.second]));
+
+    }
+
+    auto isGoal = [&](int v) { return std::find(goalNodes.begin(), goalNodes.end(), v) != goalNodes.end(); };
+
+    auto h = [&](int v) {
+
+        float best = 1e30f;
+
+        for (size_t k = 0; k < goals.size(); k += 3) best = std::min(best, MazeGraph::arc(&mazeGraph.pos[(size_t)v * 3], &goals[k]));
+
+        return best;
+
+    };
+
+    pathFinder.search(mazeGraph, mazeGraph.node(f, r, c), isGoal, h, routeNodes, itemRouteCost);
+
+    itemRouteExpanded = pathFinder.expanded;
+
+    for (int v : routeNodes) {
+
+        CubeCell p;
+
+        mazeGraph.cellOf(v, p.f, p.r, p.c);
+
+        itemRoute.push_back(p);
+
+    }
+
+}
+
+
+
+// [߰] θ ٴ   [] ĭ   ĳÿ (׷ )
+
+void drawItemRoute() {
+
+    if (!showRoute || itemRoute.size() < 2) return;
+
+    float radius = planetRadius + 0.3f;
+
+    glDisable(GL_LIGHTING);
+
+    glColor3f(0.2f, 1.0f, 0.4f);
+
+    glLineWidth(3.0f);
+
+    glBegin(GL_LINE_STRIP);
+
+    for (const CubeCell& p : itemRoute) {
+
+        Point3D v = latticePoint(p.f, latIndex(p.c, LAT_CENTER), latIndex(p.r, LAT_CENTER), radius);
+
+        glVertex3f(v.x, v.y, v.z);
+
+    }
+
+    glEnd();
+
+    glLineWidth(1.0f);
+
+    glEnable(GL_LIGHTING);
+
+}
+
+
+
+// [߰] Ʈ ׸: GL 1.1 νϽ Ƿ ġ 迭 ϳ    (Ʈ   ȣ 1)
+
+void drawAgents() {
+
+    if (agents.size() == 0) return;
+
+    glDisable(GL_LIGHTING);
+
+    glColor3f(1.0f, 0.5f, 0.1f);
+
+    glPointSize(5.0f);
+
+    glEnableClientState(GL_VERTEX_ARRAY);
+
+    glVertexPointer(3, GL_FLOAT, 0, agents.pos.data());
+
+    glDrawArrays(GL_POINTS, 0, agents.size());
+
+    glDisableClientState(GL_VERTEX_ARRAY);
+
+    glPointSize(1.0f);
+
+    glEnable(GL_LIGHTING);
+
+}
+
+
+
+// [ ׸ ]   items Ʈ ϵ 
+
+void drawScene(bool isWireMode) {
+
+    glLightModelf(GL_LIGHT_MODEL_TWO_SIDE, 1.0); glDisable(GL_CULL_FACE);
+
+    GLfloat w[] = { 1,1,1,1 }, b[] = { 0,0,0,1 };
+
+    setMaterial(w, b, 0);
+
+
+
+    if (isWireMode) {
+
+        glDisable(GL_LIGHTING); glColor3f(0.3f, 0.3f, 0.3f);
+
+        glutWireSphere(planetRadius, 20, 20); glEnable(GL_LIGHTING);
+
+    }
+
+    else {
+
+        drawFloorMesh(); // []   gluSphere   ٴ ޽
+
+    }
+
+
+
+    //  ׸ ( ޽  )
+
+    drawWallMesh();
+
+
+
+    // []  ׸: Ұ   𵨺  ιǷ 𵨸  
+
+    //  glColorMaterial νϽ glColor3f   (glMaterial  ü ٽ  )
+
+    // ݻ籤 /      ( ݻ籤  )
+
+    // [] ؽó  (ٴ, )   ׸    
+
+    setTexturing(false);
+
+    GLfloat itemSpec[] = { 0.5f, 0.5f, 0.5f, 1.0f };
+
+    glMaterialfv(GL_FRONT_AND_BACK, GL_SPECULAR, itemSpec);
+
+    glMaterialf(GL_FRONT_AND_BACK, GL_SHININESS, 100);
+
+    glColorMaterial(GL_FRONT_AND_BACK, GL_AMBIENT_AND_DIFFUSE);
+
+    glEnable(GL_COLOR_MATERIAL);
+
+    currentMaterial.valid = false; //    ¸ ٲٹǷ  setMaterial ٽ 
+
+    renderStats.materialChanges++;
+
+    for (int mi = 0; mi < items.modelCount() && mi < (int)models.size(); mi++) {
+
+        if (items.modelBegin(mi) == items.modelEnd(mi)) continue;
+
+        GLuint list = models[mi].list;
+
+        for (int s = items.modelBegin(mi); s < items.modelEnd(mi); s++) {
+
+            Point3D center = { items.posX[s], items.posY[s], items.posZ[s] };
+
+            if (!sphereInFrustum(center, 3.0f)) { cullStats.itemsCulled++; continue; }
+
+            cullStats.itemsDrawn++;
+
+
+
+            glColor3f(items.colorR[s], items.colorG[s], items.colorB[s]);
+
+            glPushMatrix(); glMultMatrixf(&items.transform[(size_t)s * 16]); glCallList(list); glPopMatrix();
+
+        }
+
+    }
+
+    glDisable(GL_COLOR_MATERIAL);
+
+
+
+    drawAgents(); // [߰]
+
+    drawItemRoute(); // [߰]
+
+}
+
+
+
+// ----------------------------------------------------------
+
+// [ ȭ ĳ] Ʈ ؽó  / ٽ ׸ Ǵ / ؽó  ׸
+
+// (GL 1.1 FBO Ƿ  ۸ glCopyTexSubImage2D )
+
+// ----------------------------------------------------------
+
+bool viewCacheUsable(const ViewCache& vc, int w, int h, bool useYaw) {
+
+    if (!vc.valid || vc.w != w || vc.h != h || vc.sceneVersion != sceneVersion) return false;
+
+    if (agentSteps - vc.agentSteps > VIEW_CACHE_AGENT_TICKS) return false; // [߰] ȸ ó NPC   
+
+    if (useYaw && fabs(vc.yaw - cameraYaw) * 180.0f / M_PI > VIEW_CACHE_ANGLE_DEG) return false;
+
+
+
+    //  ȸ  : trace(R_old^T * R_new) = 1 + 2cos(theta)
+
+    float trace = 0.0f;
+
+    for (int i = 0; i < 3; i++)
+
+        for (int j = 0; j < 3; j++) trace += vc.rot[i * 4 + j] * planetRotationMatrix[i * 4 + j];
+
+    float cosTheta = (trace - 1.0f) * 0.5f;
+
+    return cosTheta > cos(VIEW_CACHE_ANGLE_DEG * M_PI / 180.0f);
+
+}
+
+
+
+void captureViewCache(ViewCache& vc, int x, int y, int w, int h) {
+
+    if (vc.tex == 0) glGenTextures(1, &vc.tex);
+
+    bindTexture(vc.tex);
+
+    if (vc.texW < w || vc.texH < h) {
+
+        vc.texW = 1; while (vc.texW < w) vc.texW *= 2;
+
+        vc.texH = 1; while (vc.texH < h) vc.texH *= 2;
+
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+
+        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB, vc.texW, vc.texH, 0, GL_RGB, GL_UNSIGNED_BYTE, NULL);
+
+    }
+
+    glCopyTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, x, y, w, h);
+
+
+
+    vc.w = w; vc.h = h;
+
+    for (int i = 0; i < 16; i++) vc.rot[i] = planetRotationMatrix[i];
+
+    vc.yaw = cameraYaw;
+
+    vc.sceneVersion = sceneVersion;
+
+    vc.agentSteps = agentSteps;
+
+    vc.valid = true;
+
+}
+
+
+
+void blitViewCache(const ViewCache& vc, int x, int y, int w, int h) {
+
+    glViewport(x, y, w, h);
+
+    glDisable(GL_LIGHTING); glDisable(GL_DEPTH_TEST);
+
+    glMatrixMode(GL_PROJECTION); glLoadIdentity(); gluOrtho2D(0, 1, 0, 1);
+
+    glMatrixMode(GL_MODELVIEW); glLoadIdentity();
+
+
+
+    float s = (float)vc.w / vc.texW, t = (float)vc.h / vc.texH;
+
+    setTexturing(true); bindTexture(vc.tex);
+
+    glColor3f(1, 1, 1);
+
+    glBegin(GL_QUADS);
+
+    glTexCoord2f(0, 0); glVertex2f(0, 0); glTexCoord2f(s, 0); glVertex2f(1, 0);
+
+    glTexCoord2f(s, t); glVertex2f(1, 1); glTexCoord2f(0, t); glVertex2f(0, 1);
+
+    glEnd();
+
+    setTexturing(false);
+
+    glEnable(GL_LIGHTING); glEnable(GL_DEPTH_TEST);
+
+}
+
+
+
+void drawText(const char* str, float x, float y, float r, float g, float b) {
+
+    glDisable(GL_LIGHTING); glDisable(GL_DEPTH_TEST);
+
+    glMatrixMode(GL_PROJECTION); glPushMatrix(); glLoadIdentity(); gluOrtho2D(0, winW, 0, winH);
+
+    glMatrixMode(GL_MODELVIEW); glPushMatrix(); glLoadIdentity();
+
+    glColor3f(r, g, b); glRasterPos2f(x, y);
+
+    for (const char* c = str; *c != '\0'; c++) glutBitmapCharacter(GLUT_BITMAP_HELVETICA_18, *c);
+
+    glPopMatrix(); glMatrixMode(GL_PROJECTION); glPopMatrix(); glMatrixMode(GL_MODELVIEW);
+
+    glEnable(GL_LIGHTING); glEnable(GL_DEPTH_TEST);
+
+}
+
+
+
+void display() {
+
+    glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+
+    planetOrientation.toMatrix(planetRotationMatrix); // [߰] ̹ ӿ ׸ ༺ ȸ 
+
+    if (showRoute) updateItemRoute(); // [߰]
+
+    glEnable(GL_LIGHTING); glEnable(GL_LIGHT0);
+
+    GLfloat lPos[] = { 0, 0, 0, 1 };
+
+
+
+    float eyeY = -planetRadius + playerHeight;
+
+    float lx = sin(cameraYaw) * cos(cameraPitch);
+
+    float ly = sin(cameraPitch);
+
+    float lz = -cos(cameraYaw) * cos(cameraPitch);
+
+
+
+    // [߰] ø CPU  (GL ø İ  )
+
+    float projM[16], viewM[16], yawM[16], naviM[16];
+
+    cullStats = { 0, 0, 0, 0 };
+
+    renderStats = { 0, 0, 0, 0 };
+
+    frameCounter++; bakesThisFrame = 0;
+
+    evictWallChunks();
+
+    auxViewsRendered = 0; auxViewsCached = 0;
+
+
+
+    // [] 1Ī   1000  (ū ༺  ûũ  ),
+
+    // ༺ /߽ɿ   ȭ   ø
+
+    float farFPS = 1000.0f, farAux = (planetRadius * 4.0f > 1000.0f) ? planetRadius * 4.0f : 1000.0f;
+
+    auto setView = [&](int x, int y, int w, int h, float zFar) {
+
+        glViewport(x, y, w, h);
+
+        glMatrixMode(GL_PROJECTION); glLoadIdentity();
+
+        gluPerspective(60.0f, (float)w / h, 0.1f, zFar);
+
+        glMatrixMode(GL_MODELVIEW); glLoadIdentity();
+
+        mat4Perspective(60.0f, (float)w / h, 0.1f, zFar, projM);
+
+        };
+
+
+
+    if (viewMode == 0) { // 1Ī Ǯũ
+
+        setView(0, 0, winW, winH, farFPS);
+
+        gluLookAt(0, eyeY, 0, lx, eyeY + ly, lz, 0, 1, 0);
+
+        mat4LookAt({ 0, eyeY, 0 }, { lx, eyeY + ly, lz }, { 0, 1, 0 }, viewM);
+
+        setCullFrustum(projM, viewM, planetRotationMatrix);
+
+        glLightfv(GL_LIGHT0, GL_POSITION, lPos);
+
+        glPushMatrix(); glMultMatrixf(planetRotationMatrix); drawScene(false); glPopMatrix();
+
+    }
+
+    else { // 3
+
+        setView(0, 0, winW / 2, winH, farFPS); //  (FPS)
+
+        gluLookAt(0, eyeY, 0, lx, eyeY + ly, lz, 0, 1, 0);
+
+        mat4LookAt({ 0, eyeY, 0 }, { lx, eyeY + ly, lz }, { 0, 1, 0 }, viewM);
+
+        setCullFrustum(projM, viewM, planetRotationMatrix);
+
+        glLightfv(GL_LIGHT0, GL_POSITION, lPos);
+
+        glPushMatrix(); glMultMatrixf(planetRotationMatrix); drawScene(false); glPopMatrix();
+
+
+
+        // []  ȭ 2 ĳð ȿϸ ؽó  ׸
+
+        int auxW = winW / 2, auxH = winH / 2;
+
+        if (viewCacheUsable(naviCache, auxW, auxH, true)) {
+
+            blitViewCache(naviCache, winW / 2, winH / 2, auxW, auxH); auxViewsCached++;
+
+        }
+
+        else {
+
+            setView(winW / 2, winH / 2, auxW, auxH, farAux); //  (Navi)
+
+            gluLookAt(0, 0, 0, 0, -1, 0, 0, 0, -1);
+
+            mat4LookAt({ 0, 0, 0 }, { 0, -1, 0 }, { 0, 0, -1 }, viewM);
+
+            mat4RotateY(cameraYaw * 180 / M_PI, yawM);
+
+            mat4Multiply(yawM, planetRotationMatrix, naviM);
+
+            setCullFrustum(projM, viewM, naviM);
+
+            glLightfv(GL_LIGHT0, GL_POSITION, lPos);
+
+            glPushMatrix(); glRotatef(cameraYaw * 180 / M_PI, 0, 1, 0);
+
+            glMultMatrixf(planetRotationMatrix); drawScene(false); glPopMatrix();
+
+            glDisable(GL_LIGHTING); glPushMatrix(); glTranslatef(0, -planetRadius + 1, 0); glColor3f(1, 0, 0); glutSolidCube(2); glPopMatrix(); glEnable(GL_LIGHTING);
+
+            captureViewCache(naviCache, winW / 2, winH / 2, auxW, auxH); auxViewsRendered++;
+
+        }
+
+
+
+        if (viewCacheUsable(absCache, auxW, auxH, false)) {
+
+            blitViewCache(absCache, winW / 2, 0, auxW, auxH); auxViewsCached++;
+
+        }
+
+        else {
+
+            setView(winW / 2, 0, auxW, auxH, farAux); //  (Absolute)
+
+            float camD = planetRadius * 150.0f / BASE_RADIUS; //  80  150
+
+            gluLookAt(0, -camD, -camD, 0, 0, 0, 0, 1, 0);
+
+            mat4LookAt({ 0, -camD, -camD }, { 0, 0, 0 }, { 0, 1, 0 }, viewM);
+
+            setCullFrustum(projM, viewM, planetRotationMatrix);
+
+            glLightfv(GL_LIGHT0, GL_POSITION, lPos);
+
+            glPushMatrix(); glMultMatrixf(planetRotationMatrix); drawScene(true); glPopMatrix();
+
+            glDisable(GL_LIGHTING); glPushMatrix(); glTranslatef(0, -planetRadius, 0); glColor3f(1, 0, 1); glutSolidCube(3); glPopMatrix(); glEnable(GL_LIGHTING);
+
+            captureViewCache(absCache, winW / 2, 0, auxW, auxH); auxViewsRendered++;
+
+        }
+
+    }
+
+
+
+    char info[128];
+
+    sprintf(info, "Score: %d | Mode: %s ('V' to switch) | Move: WASD | Look: Mouse | Interact: SPACE | ESC: Toggle Mouse", score, (viewMode == 0 ? "Game" : "Debug"));
+
+    drawText(info, 20, winH - 30, 1, 1, 1);
+
+
+
+    if (viewMode == 1) { // [߰]  ȭ鿡 ø  ǥ
+
+        char stats[200];
+
+        sprintf(stats, "Culling: %s ('C') | Wall chunks drawn %d / culled %d | Items drawn %d / culled %d | Aux views rendered %d / cached %d",
+
+            cullingEnabled ? "ON" : "OFF", cullStats.chunksDrawn, cullStats.chunksCulled, cullStats.itemsDrawn, cullStats.itemsCulled,
+
+            auxViewsRendered, auxViewsCached);
+
+        drawText(stats, 20, winH - 55, 1, 1, 0);
+
+
+
+        sprintf(stats, "Texture binds %d (skipped %d) | Texturing on/off %d | Material changes %d",
+
+            renderStats.binds, renderStats.bindsSkipped, renderStats.texToggles, renderStats.materialChanges);
+
+        drawText(stats, 20, winH - 80, 1, 1, 0);
+
+
+
+        sprintf(stats, "Planet N=%d | Chunks %d (size %d) | Baked %d | Baked this frame %d | Wall clearance %.1f",
+
+            N, chunkCount, chunkSize, bakedChunkCount, bakesThisFrame, wallClearance(playerLocalPosition()));
+
+        drawText(stats, 20, winH - 105, 1, 1, 0);
+
+
+
+        sprintf(stats, "Mouse events %lld | applied %lld | recentered %lld", mouseEventsReceived, mouseDeltasApplied, mouseWarps);
+
+        drawText(stats, 20, winH - 130, 1, 1, 0);
+
+
+
+        char graphInfo[128];
+
+        if (N >= HIER_PATH_MIN_N)
+
+            sprintf(graphInfo, "HPA* %d clusters, %d entrances / %d regions, %d entrances", (int)hierPath.clusters.size(), hierPath.nodeCount(),
+
+                (int)hierPath.regions.size(), hierPath.regionNodeCount());
+
+        else sprintf(graphInfo, "Graph %d nodes, %d edges", mazeGraph.nodeCount(), mazeGraph.edgeCount());
+
+        sprintf(stats, "Route ('R'): %s | shortest of %d closest items %d cells, %.1f units (%d nodes expanded) | %s",
+
+            showRoute ? "ON" : "OFF", ROUTE_CANDIDATES, itemRoute.empty() ? 0 : (int)itemRoute.size() - 1, itemRouteCost * planetRadius,
+
+            itemRouteExpanded, graphInfo);
+
+        drawText(stats, 20, winH - 155, 1, 1, 0);
+
+    }
+
+
+
+    if (missionComplete()) {
+
+        float a = (float)(simTicks * SIM_TICK * 3.0); // []    ùķ̼ ð 
+
+        drawText("MISSION COMPLETE!", winW / 2 - 80, winH / 2, 1, fabs(sin(a)), 0);
+
+    }
+
+    glutSwapBuffers();
+
+}
+
+
+
+void reshape(int w, int h) { winW = w; winH = h; }
+
+
+
+// ----------------------------------------------------------
+
+// [浹 üũ ] Ʈ  浹  (߿!)
+
+// *ڴ getNeighborValue Ͽ ƴ *
+
+// [] ̿ ȸ wallBits  Ʈ ( , ĭ 4 ȸ )
+
+// [] ÷̾ ༺  ǥ   ű,   ִ ĭ  ĭ   ʸӱ ˻
+
+// ĭ  +   ǥ Ÿ   (sqrt /   )
+
+// ----------------------------------------------------------
+
+bool wallCellHit(int f, int r, int c, Point3D local, float dist2) {
+
+    if (!wallBits.isWall(f, r, c)) return false;
+
+    int conn = wallBits.mask(f, r, c);
+
+    float h = planetRadius - 1.5f;
+
+    int uc = latIndex(c, LAT_CENTER), vc = latIndex(r, LAT_CENTER);
+
+
+
+    Point3D probe[5];
+
+    int count = 0;
+
+    probe[count++] = latticePoint(f, uc, vc, h); // 1. ߽ 
+
+    if (conn & WallBits::CONN_L) probe[count++] = latticePoint(f, latIndex(c, LAT_EDGE), vc, h); // 2.  
+
+    if (conn & WallBits::CONN_R) probe[count++] = latticePoint(f, latIndex(c + 1, LAT_EDGE), vc, h);
+
+    if (conn & WallBits::CONN_U) probe[count++] = latticePoint(f, uc, latIndex(r, LAT_EDGE), h);
+
+    if (conn & WallBits::CONN_D) probe[count++] = latticePoint(f, uc, latIndex(r + 1, LAT_EDGE), h);
+
+
+
+    for (int i = 0; i < count; i++) {
+
+        float dx = probe[i].x - local.x, dy = probe[i].y - local.y, dz = probe[i].z - local.z;
+
+        if (dx * dx + dy * dy + dz * dz < dist2) return true;
+
+    }
+
+    return false;
+
+}
+
+
+
+// [߰] visitNearCells  ĭ  +  ĭ ǥ ( ּ ؽ, ĭ ȣ + 1 ְ 0 =  ڸ)
 
-    FILE* fp = fopen(filename, "r");
+// ǥ ĭ    Ѱ ؼ Ȯ   O(1)
 
+struct NearCellSet {
 
+    std::vector<CubeCell> cells;
 
-    // 1.  ü  
+    std::vector<int> slots;
 
-    if (!fp) {
 
-        if (!models.empty()) {
 
-            models.push_back(models[0]); // 0  
+    // expected:  ĭ  (ġ add ø)
 
-            // ( 縸 )
+    void reset(int expected) {
 
-        }
+        size_t cap = 64;
 
-        else {
+        while (cap < (size_t)expected * 2) cap <<= 1;
 
-            Model m; models.push_back(m); // ־   
+        cells.clear();
 
-        }
+        cells.reserve(expected);
 
-        return;
+        slots.assign(cap, 0);
 
     }
 
 
 
-    Model m;
-
-    char buf[128]; int numV = 0, numF = 0;
+    size_t find(int key) const {
 
+        size_t mask = slots.size() - 1;
 
+        size_t i = ((unsigned)key * 2654435761u) & mask;
 
-    //  б õ
+        while (slots[i] != 0 && slots[i] != key + 1) i = (i + 1) & mask;
 
-    if (fscanf(fp, "%s %s %d", buf, buf, &numV) != 3) numV = 0;
+        return i;
 
+    }
 
 
-    for (int i = 0; i < numV; i++) {
 
-        Point3D p;
+    bool contains(int key) const { return slots[find(key)] != 0; }
 
-        if (fscanf(fp, "%f %f %f", &p.x, &p.y, &p.z) == 3) m.vertices.push_back(p);
 
-    }
 
+    void add(const CubeCell& cell, int key) {
 
+        slots[find(key)] = key + 1;
 
-    if (fscanf(fp, "%s %s %d", buf, buf, &numF) != 3) numF = 0;
+        cells.push_back(cell);
 
+        if (cells.size() * 2 <= slots.size()) return;
 
+        std::vector<int> old;
 
-    for (int i = 0; i < numF; i++) {
+        old.swap(slots);
 
-        Face f;
+        slots.assign(old.size() * 2, 0);
 
-        if (fscanf(fp, "%d %d %d", &f.v1, &f.v2, &f.v3) == 3) m.faces.push_back(f);
+        for (int k : old) if (k != 0) slots[find(k - 1)] = k;
 
     }
 
-    fclose(fp);
+};
 
+NearCellSet nearCells; //  ( ) 
 
 
-    // 2. [ٽ ]  ־, 빰 ν  (̳  )
 
-    //  쿡     0  ؼ ϴ.
+//  center ִ ĭ  ¿   (  CubeTopology.h ǥ Ѿ)
 
-    if ((m.vertices.empty() || m.faces.empty()) && !models.empty()) {
+// ĭ  center reach  ĭ fn(f, r, c) ȣ, fn true ָ ߰ true
 
-        models.push_back(models[0]);
+// [] ĭ  ũ reach ĭ ũ  ( 256ĭ ̶   )
 
-        std::cout << "Warning: " << filename << " is invalid (No data). Copied default model." << std::endl;
+//  ĭ Ȯ ؽ ǥ (  ĭ ó Ⱦ ĭ  )
 
-    }
+template <typename Fn>
 
-    else {
+bool visitNearCells(Point3D center, float reach, Fn fn) {
 
-        models.push_back(m);
+    float reach2 = reach * reach;
 
-        std::cout << "Model Loaded: " << filename << " (V: " << numV << ", F: " << numF << ")" << std::endl;
+    float h = planetRadius - 1.5f;
 
-    }
 
-}
 
+    // ĭ  cellBoundRadius (  ĭ  밢)  ʴٰ  reach   ĭ  
 
+    float cellsAcross = reach / fmax(cellBoundRadius, 1e-3f) + 1.0f;
 
-// ----------------------------------------------------------
+    nearCells.reset((int)(M_PI * cellsAcross * cellsAcross) + 8);
 
-// [ʱȭ] 6  ε   ġ
 
-// ----------------------------------------------------------
 
-void initMap() {
+    CubeCell start;
 
-    loadMapFromCSV(FACE_FRONT, "map_front.csv", 180);
+    cubeCellOf(center, N, start.f, start.r, start.c);
 
-    loadMapFromCSV(FACE_BACK, "map_back.csv", 0);
+    nearCells.add(start, (start.f * N + start.r) * N + start.c);
 
-    loadMapFromCSV(FACE_RIGHT, "map_right.csv", 90);
+    for (size_t head = 0; head < nearCells.cells.size(); head++) {
 
-    loadMapFromCSV(FACE_LEFT, "map_left.csv", -90);
+        CubeCell cur = nearCells.cells[head];
 
-    loadMapFromCSV(FACE_TOP, "map_top.csv", 0);
+        if (fn(cur.f, cur.r, cur.c)) return true;
 
-    loadMapFromCSV(FACE_BOTTOM, "map_bottom.csv", 0);
 
 
+        const int dr[4] = { -1, 1, 0, 0 };
 
-    // []  ε (myModel.dat + model_1~5.dat)
+        const int dc[4] = { 0, 0, -1, 1 };
 
-    models.clear();
+        for (int k = 0; k < 4; k++) {
 
-    loadModel("myModel.dat"); // 0  (⺻)
+            CubeCell nb;
 
-    for (int i = 1; i < 7; i++) {
+            resolveNeighbor(cur.f, cur.r + dr[k], cur.c + dc[k], nb.f, nb.r, nb.c);
 
-        char filename[64];
+            int key = (nb.f * N + nb.r) * N + nb.c;
 
-        sprintf(filename, "model_%d.dat", i);
+            if (nearCells.contains(key)) continue;
 
-        loadModel(filename);
 
-    }
 
+            Point3D p = latticePoint(nb.f, latIndex(nb.c, LAT_CENTER), latIndex(nb.r, LAT_CENTER), h);
 
+            float dx = p.x - center.x, dy = p.y - center.y, dz = p.z - center.z;
 
-    //  ġ
+            if (dx * dx + dy * dy + dz * dz < reach2) nearCells.add(nb, key);
 
-    items.clear();
+        }
 
-    float colors[6][3] = {
+    }
 
-        {1.0f, 0.0f, 0.0f}, {0.0f, 1.0f, 0.0f}, {0.0f, 0.0f, 1.0f},
+    return false;
 
-        {1.0f, 1.0f, 0.0f}, {1.0f, 0.0f, 1.0f}, {0.0f, 1.0f, 1.0f}
+}
 
-    };
 
 
+bool checkCollision() {
 
-    for (int f = 0; f < 6; f++) {
+    Point3D local = playerLocalPosition();
 
-        Item it;
 
-        it.face = f;
 
-        it.r = N / 2; it.c = N / 2;
+    // ĭ  浹 Ÿ + ĭ   2 ȿ ִ ĭ ˻
 
-        it.active = true;
+    float dist2 = COLLISION_DIST * COLLISION_DIST;
 
-        it.rot = 0.0f;
+    return visitNearCells(local, COLLISION_DIST + 2.0f * cellBoundRadius,
 
-        // ε  ŭ ȯؼ Ҵ
+        [&](int f, int r, int c) { return wallCellHit(f, r, c, local, dist2); });
 
-        if (!models.empty()) it.modelIdx = f % models.size();
+}
 
-        else it.modelIdx = 0;
 
 
+// ----------------------------------------------------------
 
-        it.rColor = colors[f][0]; it.gColor = colors[f][1]; it.bColor = colors[f][2];
+// [ 浹]  ĭ = տ     е,  ѷ COLLISION_DIST ĸ 
 
+// ÷̾() ༺  ǥ from -> to   ó  ð t (0 ~ 1)   
 
+//  ߰ ˻ϹǷ     հ  
 
-        items.push_back(it);
+// ----------------------------------------------------------
 
-        map[f][N / 2][N / 2] = 0; //  ڸ  
+struct SweepHit {
 
-    }
+    float t;        // from + (to - from) * t  
 
-    totalItems = items.size();
+    Point3D normal; //  ÷̾ , 鿡 ϴ  ( )
 
-    printf("Total Items: %d\n", totalItems);
+};
 
-}
 
 
+const float SWEEP_SKIN = 0.05f; //  ڸ ̸ŭ    (   ȿ  ʰ)
 
-// ----------------------------------------------------------
 
-// [̿ üũ] (   )
 
-// ----------------------------------------------------------
+//  ĭ (f, r, c) е (a[i] -> b[i]),      (a = b)
 
-int getNeighborValue(int f, int r, int c) {
+int wallCellSegments(int f, int r, int c, Point3D* a, Point3D* b) {
 
-    if (r >= 0 && r < N && c >= 0 && c < N) return map[f][r][c];
+    int conn = wallBits.mask(f, r, c);
 
+    float h = planetRadius - 1.5f;
 
+    int uc = latIndex(c, LAT_CENTER), vc = latIndex(r, LAT_CENTER);
 
-    int targetF = f, tr = r, tc = c;
+    Point3D center = latticePoint(f, uc, vc, h);
 
-    switch (f) {
 
-    case FACE_BOTTOM:
 
-        if (r < 0) { targetF = FACE_FRONT; tr = 0; tc = N - 1 - c; }
+    int count = 0;
 
-        else if (r >= N) { targetF = FACE_BACK; tr = 0; tc = c; }
+    if (conn & WallBits::CONN_L) b[count++] = latticePoint(f, latIndex(c, LAT_EDGE), vc, h);
 
-        else if (c < 0) { targetF = FACE_LEFT; tr = 0; tc = r; }
+    if (conn & WallBits::CONN_R) b[count++] = latticePoint(f, latIndex(c + 1, LAT_EDGE), vc, h);
 
-        else if (c >= N) { targetF = FACE_RIGHT; tr = 0; tc = N - 1 - r; }
+    if (conn & WallBits::CONN_U) b[count++] = latticePoint(f, uc, latIndex(r, LAT_EDGE), h);
 
-        break;
+    if (conn & WallBits::CONN_D) b[count++] = latticePoint(f, uc, latIndex(r + 1, LAT_EDGE), h);
 
-    case FACE_FRONT: // 0
+    if (count == 0) b[count++] = center;
 
-        if (r < 0) { targetF = FACE_BOTTOM; tr = 0; tc = N - 1 - c; }
+    for (int i = 0; i < count; i++) a[i] = center;
 
-        else if (r >= N) { targetF = FACE_TOP; tr = N - 1; tc = N - 1 - c; }
+    return count;
 
-        else if (c < 0) { targetF = FACE_RIGHT; tr = r; tc = N - 1; }
+}
 
-        else if (c >= N) { targetF = FACE_LEFT; tr = r; tc = 0; }
 
-        break;
 
-    case FACE_BACK: // 1
+//  ab  p   
 
-        if (r < 0) { targetF = FACE_BOTTOM; tr = N - 1; tc = c; }
+Point3D closestOnSegment(Point3D p, Point3D a, Point3D b) {
 
-        else if (r >= N) { targetF = FACE_TOP; tr = 0; tc = c; }
+    Point3D ab = vec3Sub(b, a);
 
-        else if (c < 0) { targetF = FACE_LEFT; tr = r; tc = N - 1; }
+    float len2 = vec3Dot(ab, ab);
 
-        else if (c >= N) { targetF = FACE_RIGHT; tr = r; tc = 0; }
+    if (len2 < 1e-8f) return a;
 
-        break;
+    float s = vec3Dot(vec3Sub(p, a), ab) / len2;
 
-    case FACE_LEFT:
+    s = (s < 0.0f) ? 0.0f : (s > 1.0f) ? 1.0f : s;
 
-        if (r < 0) { targetF = FACE_BOTTOM; tr = c; tc = 0; }
+    return vec3Add(a, vec3Scale(ab, s));
 
-        else if (r >= N) { targetF = FACE_TOP; tr = N - 1 - c; tc = 0; }
+}
 
-        else if (c < 0) { targetF = FACE_FRONT; tr = r; tc = N - 1; }
 
-        else if (c >= N) { targetF = FACE_BACK; tr = r; tc = 0; }
 
-        break;
+//  p p + d    ab  rad θ ĸ ó  t (0 ~ 1),   false
 
-    case FACE_RIGHT:
+//  ()      ̸ 
 
-        if (r < 0) { targetF = FACE_BOTTOM; tr = N - 1 - c; tc = N - 1; }
+// ̹ ĸ ȿ ϸ  İ   t = 0 (   )
 
-        else if (r >= N) { targetF = FACE_TOP; tr = c; tc = N - 1; }
+bool sweepCapsule(Point3D p, Point3D d, Point3D a, Point3D b, float rad, float& t) {
 
-        else if (c < 0) { targetF = FACE_BACK; tr = r; tc = N - 1; }
+    float rad2 = rad * rad;
 
-        else if (c >= N) { targetF = FACE_FRONT; tr = r; tc = 0; }
+    Point3D q = closestOnSegment(p, a, b);
 
-        break;
+    Point3D away = vec3Sub(p, q);
 
-    case FACE_TOP:
+    float dist2 = vec3Dot(away, away);
 
-        if (r < 0) { targetF = FACE_BACK; tr = N - 1; tc = c; }
+    float dd = vec3Dot(d, d);
 
-        else if (r >= N) { targetF = FACE_FRONT; tr = N - 1; tc = N - 1 - c; }
+    if (dist2 < rad2) {
 
-        else if (c < 0) { targetF = FACE_LEFT; tr = N - 1; tc = N - 1 - r; }
+        if (vec3Dot(d, away) >= -1e-4f * sqrt(dd * dist2)) return false;
 
-        else if (c >= N) { targetF = FACE_RIGHT; tr = N - 1; tc = r; }
+        t = 0.0f;
 
-        break;
+        return true;
 
     }
 
-    if (tr < 0) tr = 0; if (tr >= N) tr = N - 1;
+    if (dd < 1e-12f) return false;
 
-    if (tc < 0) tc = 0; if (tc >= N) tc = N - 1;
 
-    return map[targetF][tr][tc];
-
-}
 
+    float best = 2.0f;
 
+    Point3D ab = vec3Sub(b, a), m = vec3Sub(p, a);
 
-// ----------------------------------------------------------
-
-// []   ׸ Helper
+    float abab = vec3Dot(ab, ab);
 
-// ----------------------------------------------------------
+    if (abab > 1e-8f) {
 
-void drawWallSegment(int f, float u_s, float u_e, float v_s, float v_e) {
+        float md = vec3Dot(m, ab), nd = vec3Dot(d, ab);
 
-    float h = 6.0f; //  
+        float A = abab * dd - nd * nd;
 
-    Point3D p0 = getSpherePoint(f, u_s, v_s, planetRadius);
+        float B = abab * vec3Dot(m, d) - nd * md;
 
-    Point3D p1 = getSpherePoint(f, u_e, v_s, planetRadius);
+        float C = abab * (vec3Dot(m, m) - rad2) - md * md;
 
-    Point3D p2 = getSpherePoint(f, u_e, v_e, planetRadius);
+        float disc = B * B - A * C;
 
-    Point3D p3 = getSpherePoint(f, u_s, v_e, planetRadius);
+        if (A > 1e-8f && disc >= 0.0f) {
 
-    Point3D p4 = getSpherePoint(f, u_s, v_s, planetRadius - h);
+            float s = (-B - sqrt(disc)) / A;
 
-    Point3D p5 = getSpherePoint(f, u_e, v_s, planetRadius - h);
+            float k = md + s * nd; //      (0 ~ abab)
 
-    Point3D p6 = getSpherePoint(f, u_e, v_e, planetRadius - h);
+            if (s >= 0.0f && s <= 1.0f && k >= 0.0f && k <= abab) best = s;
 
-    Point3D p7 = getSpherePoint(f, u_s, v_e, planetRadius - h);
+        }
 
+    }
 
+    Point3D ends[2] = { a, b };
 
-    glBegin(GL_QUADS);
+    for (int i = 0; i < 2; i++) {
 
-    Point3D n;
+        Point3D e = vec3Sub(p, ends[i]);
 
-    n = calculateNormal(p4, p5, p6); glNormal3f(n.x, n.y, n.z);
+        float B = vec3Dot(e, d), C = vec3Dot(e, e) - rad2;
 
-    glTexCoord2f(0, 0); glVertex3f(p4.x, p4.y, p4.z); glTexCoord2f(1, 0); glVertex3f(p5.x, p5.y, p5.z);
+        float disc = B * B - dd * C;
 
-    glTexCoord2f(1, 1); glVertex3f(p6.x, p6.y, p6.z); glTexCoord2f(0, 1); glVertex3f(p7.x, p7.y, p7.z);
+        if (disc < 0.0f) continue;
 
+        float s = (-B - sqrt(disc)) / dd;
 
+        if (s >= 0.0f && s <= 1.0f && s < best) best = s;
 
-    n = calculateNormal(p0, p1, p5); glNormal3f(n.x, n.y, n.z);
+    }
 
-    glTexCoord2f(0, 0); glVertex3f(p0.x, p0.y, p0.z); glTexCoord2f(1, 0); glVertex3f(p1.x, p1.y, p1.z);
+    if (best > 1.0f) return false;
 
-    glTexCoord2f(1, 1); glVertex3f(p5.x, p5.y, p5.z); glTexCoord2f(0, 1); glVertex3f(p4.x, p4.y, p4.z);
+    t = best;
 
+    return true;
 
+}
 
-    n = calculateNormal(p1, p2, p6); glNormal3f(n.x, n.y, n.z);
 
-    glTexCoord2f(0, 0); glVertex3f(p1.x, p1.y, p1.z); glTexCoord2f(1, 0); glVertex3f(p2.x, p2.y, p2.z);
 
-    glTexCoord2f(1, 1); glVertex3f(p6.x, p6.y, p6.z); glTexCoord2f(0, 1); glVertex3f(p5.x, p5.y, p5.z);
+//  local  ĸ ( rad) ȿ ִ
 
+bool insideWallCapsules(Point3D local, float rad) {
 
+    return visitNearCells(local, rad + 2.0f * cellBoundRadius, [&](int f, int r, int c) {
 
-    n = calculateNormal(p2, p3, p7); glNormal3f(n.x, n.y, n.z);
+        if (!wallBits.isWall(f, r, c)) return false;
 
-    glTexCoord2f(0, 0); glVertex3f(p2.x, p2.y, p2.z); glTexCoord2f(1, 0); glVertex3f(p3.x, p3.y, p3.z);
+        Point3D a[4], b[4];
 
-    glTexCoord2f(1, 1); glVertex3f(p7.x, p7.y, p7.z); glTexCoord2f(0, 1); glVertex3f(p6.x, p6.y, p6.z);
+        int count = wallCellSegments(f, r, c, a, b);
 
+        for (int i = 0; i < count; i++) {
 
+            Point3D e = vec3Sub(local, closestOnSegment(local, a[i], b[i]));
 
-    n = calculateNormal(p3, p0, p4); glNormal3f(n.x, n.y, n.z);
+            if (vec3Dot(e, e) < rad * rad) return true;
 
-    glTexCoord2f(0, 0); glVertex3f(p3.x, p3.y, p3.z); glTexCoord2f(1, 0); glVertex3f(p0.x, p0.y, p0.z);
+        }
 
-    glTexCoord2f(1, 1); glVertex3f(p4.x, p4.y, p4.z); glTexCoord2f(0, 1); glVertex3f(p7.x, p7.y, p7.z);
+        return false;
 
-    glEnd();
+    });
 
 }
 
 
 
-// ----------------------------------------------------------
-
-// [] Ʈ  (  ׸)
+// from -> to ̿    
 
-// ----------------------------------------------------------
+//   (  / 2 + 浹 Ÿ + ĭ   2)  ĭ  (checkCollision  Ž)
 
-void drawSmartWall(int f, int r, int c) {
+bool sweepWalls(Point3D from, Point3D to, SweepHit& hit) {
 
-    float u1 = (float)c / N; float u2 = (float)(c + 1) / N;
+    Point3D d = vec3Sub(to, from);
 
-    float v1 = (float)r / N; float v2 = (float)(r + 1) / N;
+    Point3D mid = vec3Add(from, vec3Scale(d, 0.5f));
 
-    float cw = u2 - u1; float ch = v2 - v1;
+    float reach = 0.5f * sqrt(vec3Dot(d, d)) + COLLISION_DIST + 2.0f * cellBoundRadius;
 
-    float tw = cw * 0.2f; float th = ch * 0.2f;
 
 
+    hit.t = 2.0f;
 
-    float uc_s = u1 + (cw - tw) / 2.0f; float uc_e = u1 + (cw + tw) / 2.0f;
+    Point3D hitA = from, hitB = from;
 
-    float vc_s = v1 + (ch - th) / 2.0f; float vc_e = v1 + (ch + th) / 2.0f;
+    visitNearCells(mid, reach, [&](int f, int r, int c) {
 
+        if (!wallBits.isWall(f, r, c)) return false;
 
+        Point3D a[4], b[4];
 
-    bool connL = (getNeighborValue(f, r, c - 1) == 1);
+        int count = wallCellSegments(f, r, c, a, b);
 
-    bool connR = (getNeighborValue(f, r, c + 1) == 1);
+        for (int i = 0; i < count; i++) {
 
-    bool connU = (getNeighborValue(f, r - 1, c) == 1);
+            float t;
 
-    bool connD = (getNeighborValue(f, r + 1, c) == 1);
+            if (sweepCapsule(from, d, a[i], b[i], COLLISION_DIST, t) && t < hit.t) { hit.t = t; hitA = a[i]; hitB = b[i]; }
 
+        }
 
+        return false;
 
-    glEnable(GL_TEXTURE_2D); glBindTexture(GL_TEXTURE_2D, texWall);
+    });
 
-    GLfloat white[] = { 1,1,1,1 }; glMaterialfv(GL_FRONT_AND_BACK, GL_AMBIENT_AND_DIFFUSE, white);
+    if (hit.t > 1.0f) return false;
 
 
 
-    drawWallSegment(f, uc_s, uc_e, vc_s, vc_e);
+    //  = п   ,  ߽      ̲
 
-    if (connL) drawWallSegment(f, u1, uc_s, vc_s, vc_e);
+    Point3D at = vec3Add(from, vec3Scale(d, hit.t));
 
-    if (connR) drawWallSegment(f, uc_e, u2, vc_s, vc_e);
+    Point3D n = vec3Sub(at, closestOnSegment(at, hitA, hitB));
 
-    if (connU) drawWallSegment(f, uc_s, uc_e, v1, vc_s);
+    Point3D up = normalize(at);
 
-    if (connD) drawWallSegment(f, uc_s, uc_e, vc_e, v2);
+    n = normalize(vec3Sub(n, vec3Scale(up, vec3Dot(n, up))));
 
+    if (vec3Dot(n, n) == 0.0f) n = normalize(vec3Scale(d, -1.0f)); //   ߽ɿ  
 
+    hit.normal = n;
 
-    glDisable(GL_TEXTURE_2D);
+    return true;
 
 }
 
 
 
-// [ ׸ ]   items Ʈ ϵ 
+// [߰] ༺  ǥ local dist   ۸ fn( id)
 
-void drawScene(bool isWireMode) {
+//  ĭ  ̹Ƿ 浹 ˻  Ž (ĭ  dist + ĭ    ĭ,   ʸ )
 
-    glLightModelf(GL_LIGHT_MODEL_TWO_SIDE, 1.0); glDisable(GL_CULL_FACE);
+// ĭ  ڿ  -> fn itemIndex.remove  ( ۰ ڸ ٲ)    ǳʶ 
 
-    GLfloat w[] = { 1,1,1,1 }, b[] = { 0,0,0,1 };
+template <typename Fn>
 
-    glMaterialfv(GL_FRONT_AND_BACK, GL_AMBIENT_AND_DIFFUSE, w);
+void forEachItemNear(Point3D local, float dist, Fn fn) {
 
-    glMaterialfv(GL_FRONT_AND_BACK, GL_SPECULAR, b);
+    float dist2 = dist * dist;
 
-    glMaterialf(GL_FRONT_AND_BACK, GL_SHININESS, 0);
+    visitNearCells(local, dist + cellBoundRadius, [&](int f, int r, int c) {
 
+        int count;
 
+        const int* ids = itemIndex.at(f, r, c, count);
 
-    if (isWireMode) {
+        for (int k = count - 1; k >= 0; k--) {
 
-        glDisable(GL_LIGHTING); glColor3f(0.3f, 0.3f, 0.3f);
+            int id = ids[k], s = items.slot(id);
 
-        glutWireSphere(planetRadius, 20, 20); glEnable(GL_LIGHTING);
+            Point3D d = { items.posX[s] - local.x, items.posY[s] - local.y, items.posZ[s] - local.z };
 
-    }
+            if (vec3Dot(d, d) < dist2) fn(id);
 
-    else {
+        }
 
-        glEnable(GL_TEXTURE_2D); glBindTexture(GL_TEXTURE_2D, texFloor);
+        return false;
 
-        glColor3f(0.7f, 0.7f, 0.8f);
+    });
 
-        GLUquadric* q = gluNewQuadric(); gluQuadricTexture(q, GL_TRUE);
+}
 
-        gluSphere(q, planetRadius, 50, 50); gluDeleteQuadric(q);
 
-        glDisable(GL_TEXTURE_2D);
 
-    }
+//  id ֿ:  / ҿ  ۰ ڸ ٲ  (O(1))
 
+void pickItem(int id) {
 
+    if (!items.alive(id)) return;
 
-    //  ׸
+    score += 100;
 
-    for (int f = 0; f < 6; f++) {
+    itemIndex.remove(id);
 
-        for (int r = 0; r < N; r++) {
+    items.destroy(id);
 
-            for (int c = 0; c < N; c++) {
+    sceneVersion++; //  ȭ ĳÿ 
 
-                if (map[f][r][c] == 1) drawSmartWall(f, r, c);
+}
 
-            }
 
-        }
 
-    }
+// []     ǥ ű ʰ, ÷̾  ǥ   Ű ó ĭ ۸ ˻
 
+void checkInteraction() {
 
+    forEachItemNear(playerLocalPosition(), ITEM_PICKUP_DIST, pickItem);
 
-    // []  ׸ ()
+}
 
-    for (auto& item : items) {
 
-        if (!item.active) continue;
 
+// ----------------------------------------------------------
 
+// [ȴ ] Ʈ ĭ  ĭ   ( ĭδ  ĭ  )
 
-        // 1. [ ] (80)  ༭    
+// ̿ ĭ getNeighborValue    ǥ (cubeSeamCell) ãǷ  踦 ״ Ѿ
 
-        //     ̰(-), Ĺ  ø.
+// Ʈ ڱ ¸ а Ƿ updateAgents(begin, end) ϲ 帶 ٸ  ҷ 
 
-        float heightOffset = -2.0f;
+// ----------------------------------------------------------
 
-        Point3D center = getSpherePoint(item.face, (item.c + 0.5f) / N, (item.r + 0.5f) / N, planetRadius + heightOffset);
+bool agentWalkable(int f, int r, int c) { return grid.at(f, r, c) != 1; }
 
 
 
-        glPushMatrix();
+Point3D agentCellCenter(int f, int r, int c, float radius) {
 
+    return latticePoint(f, latIndex(c, LAT_CENTER), latIndex(r, LAT_CENTER), radius);
 
+}
 
-        // 2. [ġ ̵] ش  ̵
 
-        glTranslatef(center.x, center.y, center.z);
 
+// Ʈ i cur    ĭ:  ƴ 4 ̿  ϳ (Դ ĭ ٸ  ,    ڸ)
 
+void chooseAgentNext(int i) {
 
-        // 3. [ȸ:  ] 
+    const int dr[4] = { -1, 1, 0, 0 };
 
-        //  ġ(center)  "   (Up Vector)"Դϴ.
+    const int dc[4] = { 0, 0, -1, 1 };
 
-        //  Z(0,0,1)  ǥ (center) ġŰ Դϴ.
+    int f = agents.curFace[i], r = agents.curRow[i], c = agents.curCol[i];
 
+    CubeCell open[4], to = { f, r, c };
 
+    int count = 0;
 
-        Point3D modelUp = { 0, 0, 1 };      //    (Z ̶ )
+    for (int k = 0; k < 4; k++) {
 
-        Point3D surfNormal = normalize(center); //  ϴ 
+        CubeCell t = cubeSeamCell(f, r + dr[k], c + dc[k], N);
 
+        if (!agentWalkable(t.f, t.r, t.c)) continue;
 
+        if (t.f == agents.prevFace[i] && t.r == agents.prevRow[i] && t.c == agents.prevCol[i]) { to = t; continue; }
 
-        //    ȸ(Axis) ϱ ()
+        open[count++] = t;
 
-        Point3D axis = {
+    }
 
-            modelUp.y * surfNormal.z - modelUp.z * surfNormal.y,
+    if (count > 0) to = open[AgentCrowd::random(agents.rng[i], count)];
 
-            modelUp.z * surfNormal.x - modelUp.x * surfNormal.z,
+    agents.nextFace[i] = to.f; agents.nextRow[i] = to.r; agents.nextCol[i] = to.c;
 
-            modelUp.x * surfNormal.y - modelUp.y * surfNormal.x
+}
 
-        };
 
 
+void updateAgents(int begin, int end, float dt) {
 
-        //    (Angle) ϱ ()
+    float radius = planetRadius + AGENT_LIFT;
 
-        float dot = modelUp.x * surfNormal.x + modelUp.y * surfNormal.y + modelUp.z * surfNormal.z;
+    for (int i = begin; i < end; i++) {
 
-        float angleRad = acos(dot);
+        //  ĭ   ( ģ )  ڸ Ƽ
 
-        float angleDeg = angleRad * 180.0f / M_PI;
+        if (!agentWalkable(agents.nextFace[i], agents.nextRow[i], agents.nextCol[i])) {
 
+            std::swap(agents.curFace[i], agents.nextFace[i]);
 
+            std::swap(agents.curRow[i], agents.nextRow[i]);
 
-        //   ȸ! (   ߽ ݴ  Ĵٺϴ)
+            std::swap(agents.curCol[i], agents.nextCol[i]);
 
-        glRotatef(angleDeg, axis.x, axis.y, axis.z);
+            agents.prevFace[i] = agents.curFace[i]; agents.prevRow[i] = agents.curRow[i]; agents.prevCol[i] = agents.curCol[i];
 
+            agents.progress[i] = 1.0f - agents.progress[i];
 
+        }
 
-        // 4. []  ̷ ߴµ   ְų ̻ϸ
 
-        // Ʒ ּ Ǯ  ü  ּ. (𵨸  ޶ ʿ  )
 
-        glRotatef(-90, 1, 0, 0);  // X  90
+        float t = agents.progress[i] + agents.speed[i] * dt;
 
+        while (t >= 1.0f) {
 
+            t -= 1.0f;
 
+            agents.prevFace[i] = agents.curFace[i]; agents.prevRow[i] = agents.curRow[i]; agents.prevCol[i] = agents.curCol[i];
 
+            agents.curFace[i] = agents.nextFace[i]; agents.curRow[i] = agents.nextRow[i]; agents.curCol[i] = agents.nextCol[i];
 
-        // 5. ũ    ( ڵ )
+            chooseAgentNext(i);
 
-        glScalef(0.005f, 0.005f, 0.005f);
+        }
 
+        agents.progress[i] = t;
 
 
-        GLfloat color[] = { item.rColor, item.gColor, item.bColor, 1.0f };
 
-        glMaterialfv(GL_FRONT_AND_BACK, GL_AMBIENT_AND_DIFFUSE, color);
+        //  ĭ  ̸ հ  ( 踦 Ѵ ߿ ٴ )
 
-        glMaterialfv(GL_FRONT_AND_BACK, GL_SPECULAR, color);
+        Point3D a = agentCellCenter(agents.curFace[i], agents.curRow[i], agents.curCol[i], radius);
 
-        glMaterialf(GL_FRONT_AND_BACK, GL_SHININESS, 100);
+        Point3D b = agentCellCenter(agents.nextFace[i], agents.nextRow[i], agents.nextCol[i], radius);
 
+        Point3D p = vec3Scale(normalize(vec3Add(vec3Scale(a, 1.0f - t), vec3Scale(b, t))), radius);
 
+        agents.pos[(size_t)i * 3] = p.x; agents.pos[(size_t)i * 3 + 1] = p.y; agents.pos[(size_t)i * 3 + 2] = p.z;
 
-        if (!models.empty()) {
+    }
 
-            Model& m = models[item.modelIdx];
+}
 
-            glBegin(GL_TRIANGLES);
 
-            for (auto& fc : m.faces) {
 
-                Point3D p1 = m.vertices[fc.v1], p2 = m.vertices[fc.v2], p3 = m.vertices[fc.v3];
+//  ƴ  ĭ count  ( seed  )
 
-                Point3D n = calculateNormal(p1, p2, p3); glNormal3f(n.x, n.y, n.z);
+void spawnAgents(int count, uint32_t seed) {
 
-                glVertex3f(p1.x, p1.y, p1.z); glVertex3f(p2.x, p2.y, p2.z); glVertex3f(p3.x, p3.y, p3.z);
+    agents.clear();
 
-            }
+    agents.resize(count);
 
-            glEnd();
+    uint32_t s = seed | 1u;
 
-        }
+    int placed = 0;
 
-        glPopMatrix();
+    for (int tries = 0; placed < count && tries < count * 64; tries++) {
 
-    }
+        int f = AgentCrowd::random(s, 6), r = AgentCrowd::random(s, N), c = AgentCrowd::random(s, N);
 
-}
+        if (!agentWalkable(f, r, c)) continue;
 
+        int i = placed++;
 
+        agents.curFace[i] = agents.prevFace[i] = f;
 
-void drawText(const char* str, float x, float y, float r, float g, float b) {
+        agents.curRow[i] = agents.prevRow[i] = r;
 
-    glDisable(GL_LIGHTING); glDisable(GL_DEPTH_TEST);
+        agents.curCol[i] = agents.prevCol[i] = c;
 
-    glMatrixMode(GL_PROJECTION); glPushMatrix(); glLoadIdentity(); gluOrtho2D(0, winW, 0, winH);
+        agents.speed[i] = AGENT_SPEED_MIN + (AGENT_SPEED_MAX - AGENT_SPEED_MIN) * AgentCrowd::random(s, 1000) / 1000.0f;
 
-    glMatrixMode(GL_MODELVIEW); glPushMatrix(); glLoadIdentity();
+        agents.rng[i] = (seed ^ (uint32_t)(i * 2654435761u)) | 1u;
 
-    glColor3f(r, g, b); glRasterPos2f(x, y);
+        chooseAgentNext(i);
 
-    for (const char* c = str; *c != '\0'; c++) glutBitmapCharacter(GLUT_BITMAP_HELVETICA_18, *c);
+    }
 
-    glPopMatrix(); glMatrixMode(GL_PROJECTION); glPopMatrix(); glMatrixMode(GL_MODELVIEW);
+    if (placed < count) agents.resize(placed); //  ĭ   
 
-    glEnable(GL_LIGHTING); glEnable(GL_DEPTH_TEST);
+    updateAgents(0, agents.size(), 0.0f);
 
 }
 
 
 
-void display() {
+//  ƽŭ  Ʈ Ȱ , Ʈ  true (ٽ ׷ )
 
-    glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+// []  ƽ   ->  ȭ ĳô VIEW_CACHE_AGENT_TICKSٸ ٽ ׸ (  ״)
 
-    glEnable(GL_LIGHTING); glEnable(GL_LIGHT0);
+bool stepAgents(float dt) {
 
-    GLfloat lPos[] = { 0, 0, 0, 1 };
+    if (agents.size() == 0) return false;
 
+    agentJobs.parallelFor(agents.size(), AGENT_BATCH, [dt](int begin, int end) { updateAgents(begin, end, dt); });
 
+    agentSteps++;
 
-    float eyeY = -planetRadius + playerHeight;
+    return true;
 
-    float lx = sin(cameraYaw) * cos(cameraPitch);
+}
 
-    float ly = sin(cameraPitch);
 
-    float lz = -cos(cameraYaw) * cos(cameraPitch);
 
+// [] ༺ axis(X, 0, Z) ѷ angle  ŭ ȵ,   ǵ ʰ   ̲
 
+// 1.  ü ؼ    
 
-    auto setView = [&](int x, int y, int w, int h) {
+// 2.          (  ƾ 2)
 
-        glViewport(x, y, w, h);
+// 3.    ,   ڸ ű ȸ ༺  ʿ 
 
-        glMatrixMode(GL_PROJECTION); glLoadIdentity();
+void stepPlanet(float angle, float axisX, float axisZ) {
 
-        gluPerspective(60.0f, (float)w / h, 0.1f, 1000.0f);
+    Quat moved = planetOrientation;
 
-        glMatrixMode(GL_MODELVIEW); glLoadIdentity();
+    moved.rotateWorld(angle, axisX, 0.0f, axisZ);
 
-        };
 
 
+    Point3D from = playerLocalPosition();
 
-    if (viewMode == 0) { // 1Ī Ǯũ
+    Point3D to = playerLocalPosition(moved);
 
-        setView(0, 0, winW, winH);
+    SweepHit hit;
 
-        gluLookAt(0, eyeY, 0, lx, eyeY + ly, lz, 0, 1, 0);
+    if (!sweepWalls(from, to, hit)) {
 
-        glLightfv(GL_LIGHT0, GL_POSITION, lPos);
+        planetOrientation = moved;
 
-        glPushMatrix(); glMultMatrixf(planetRotationMatrix); drawScene(false); glPopMatrix();
+        return;
 
     }
 
-    else { // 3
-
-        setView(0, 0, winW / 2, winH); //  (FPS)
 
-        gluLookAt(0, eyeY, 0, lx, eyeY + ly, lz, 0, 1, 0);
 
-        glLightfv(GL_LIGHT0, GL_POSITION, lPos);
+    Point3D d = vec3Sub(to, from);
 
-        glPushMatrix(); glMultMatrixf(planetRotationMatrix); drawScene(false); glPopMatrix();
+    float len = sqrt(vec3Dot(d, d));
 
+    float t = hit.t - SWEEP_SKIN / len;
 
+    if (t < 0.0f) t = 0.0f;
 
-        setView(winW / 2, winH / 2, winW / 2, winH / 2); //  (Navi)
+    Point3D p = vec3Add(from, vec3Scale(d, t));
 
-        gluLookAt(0, 0, 0, 0, -1, 0, 0, 0, -1);
 
-        glLightfv(GL_LIGHT0, GL_POSITION, lPos);
 
-        glPushMatrix(); glRotatef(cameraYaw * 180 / M_PI, 0, 1, 0);
+    Point3D rest = vec3Scale(d, 1.0f - t);
 
-        glMultMatrixf(planetRotationMatrix); drawScene(false); glPopMatrix();
+    rest = vec3Sub(rest, vec3Scale(hit.normal, vec3Dot(rest, hit.normal)));
 
-        glDisable(GL_LIGHTING); glPushMatrix(); glTranslatef(0, -planetRadius + 1, 0); glColor3f(1, 0, 0); glutSolidCube(2); glPopMatrix(); glEnable(GL_LIGHTING);
+    float restLen = sqrt(vec3Dot(rest, rest));
 
+    if (restLen > 1e-4f) {
 
+        SweepHit slide;
 
-        setView(winW / 2, 0, winW / 2, winH / 2); //  (Absolute)
+        if (sweepWalls(p, vec3Add(p, rest), slide)) {
 
-        gluLookAt(0, -150, -150, 0, 0, 0, 0, 1, 0);
+            float s = slide.t - SWEEP_SKIN / restLen;
 
-        glLightfv(GL_LIGHT0, GL_POSITION, lPos);
+            rest = vec3Scale(rest, (s < 0.0f) ? 0.0f : s);
 
-        glPushMatrix(); glMultMatrixf(planetRotationMatrix); drawScene(true); glPopMatrix();
+        }
 
-        glDisable(GL_LIGHTING); glPushMatrix(); glTranslatef(0, -planetRadius, 0); glColor3f(1, 0, 1); glutSolidCube(3); glPopMatrix(); glEnable(GL_LIGHTING);
+        p = vec3Add(p, rest);
 
     }
 
 
 
-    char info[128];
-
-    sprintf(info, "Score: %d | Mode: %s ('V' to switch) | Move: WASD | Look: Mouse | Interact: SPACE | ESC: Toggle Mouse", score, (viewMode == 0 ? "Game" : "Debug"));
+    float height = sqrt(vec3Dot(from, from));
 
-    drawText(info, 20, winH - 30, 1, 1, 1);
+    p = vec3Scale(normalize(p), height);
 
+    Point3D axis = vec3Cross(p, from); // p from ű ȸ -> ༺ *  ȸ ϸ p ÷̾ ߹ 
 
+    float sinLen = sqrt(vec3Dot(axis, axis));
 
-    if (score == totalItems * 100) {
+    if (sinLen == 0.0f) return;
 
-        static float a = 0; a += 0.05f;
+    float deg = atan2(sinLen, vec3Dot(p, from)) * 180.0f / M_PI; //   acos Ȯ
 
-        drawText("MISSION COMPLETE!", winW / 2 - 80, winH / 2, 1, fabs(sin(a)), 0);
+    planetOrientation.rotateLocal(deg, axis.x, axis.y, axis.z);
 
-    }
+}
 
-    glutSwapBuffers();
 
-}
 
+// [] յ      (  ϹǷ    ̷)
 
+void movePlayer(float moveSpeed, float strafeSpeed) {
 
-void reshape(int w, int h) { winW = w; winH = h; }
+    float sinYaw = sin(cameraYaw), cosYaw = cos(cameraYaw);
 
+    float axisX = moveSpeed * cosYaw + strafeSpeed * sinYaw;
 
+    float axisZ = moveSpeed * sinYaw - strafeSpeed * cosYaw;
 
-// ----------------------------------------------------------
+    float angle = sqrt(moveSpeed * moveSpeed + strafeSpeed * strafeSpeed);
 
-// [浹 üũ ] Ʈ  浹  (߿!)
 
-// *ڴ getNeighborValue Ͽ ƴ *
 
-// ----------------------------------------------------------
+    if (angle == 0.0f) return;
 
-bool checkCollision() {
+    angle *= BASE_RADIUS / planetRadius; // [߰] ༺ Ŀ   Ÿ 
 
-    Point3D playerPos = { 0.0f, -planetRadius + 1.5f, 0.0f };
+    stepPlanet(angle, axisX, axisZ);
 
-    float collisionDist = 3.5f;
+}
 
 
 
-    for (int f = 0; f < 6; f++) {
+// [߰]   콺 ̵    ,  true
 
-        for (int r = 0; r < N; r++) {
+bool applyMouseLook() {
 
-            for (int c = 0; c < N; c++) {
+    if (mouseDX == 0 && mouseDY == 0) return false;
 
-                if (map[f][r][c] == 1) {
+    cameraYaw += mouseDX * mouseSensitivity;
 
-                    // 1. ߽  üũ
+    cameraPitch -= mouseDY * mouseSensitivity;
 
-                    Point3D pC = multiplyMatrixVector(getSpherePoint(f, (c + 0.5f) / N, (r + 0.5f) / N, planetRadius - 1.5f), planetRotationMatrix);
+    if (cameraPitch > 1.5f) cameraPitch = 1.5f;
 
-                    float dC = sqrt(pow(pC.x - playerPos.x, 2) + pow(pC.y - playerPos.y, 2) + pow(pC.z - playerPos.z, 2));
+    if (cameraPitch < -1.5f) cameraPitch = -1.5f;
 
-                    if (dC < collisionDist) return true;
+    mouseDX = mouseDY = 0;
 
+    mouseDeltasApplied++;
 
+    return true;
 
-                    // 2.  (Edge) üũ
+}
 
-                    if (getNeighborValue(f, r, c - 1) == 1) { // Left
 
-                        Point3D pL = multiplyMatrixVector(getSpherePoint(f, (float)c / N, (r + 0.5f) / N, planetRadius - 1.5f), planetRotationMatrix);
 
-                        if (sqrt(pow(pL.x - playerPos.x, 2) + pow(pL.y - playerPos.y, 2) + pow(pL.z - playerPos.z, 2)) < collisionDist) return true;
+// [߰]  ƽ: 콺     ִ WASD ȱ (밢  ӵ), ȭ ٲ true
 
-                    }
+bool simulateTick() {
 
-                    if (getNeighborValue(f, r, c + 1) == 1) { // Right
+    simTicks++;
 
-                        Point3D pR = multiplyMatrixVector(getSpherePoint(f, (float)(c + 1) / N, (r + 0.5f) / N, planetRadius - 1.5f), planetRotationMatrix);
+    bool walked = stepAgents((float)SIM_TICK); // [߰] NPC ̼ǰ   
 
-                        if (sqrt(pow(pR.x - playerPos.x, 2) + pow(pR.y - playerPos.y, 2) + pow(pR.z - playerPos.z, 2)) < collisionDist) return true;
+    bool looked = applyMouseLook() || walked;
 
-                    }
+    if (missionComplete()) looked = true; // MISSION COMPLETE  (  ڿ    )
 
-                    if (getNeighborValue(f, r - 1, c) == 1) { // Up
 
-                        Point3D pU = multiplyMatrixVector(getSpherePoint(f, (c + 0.5f) / N, (float)r / N, planetRadius - 1.5f), planetRotationMatrix);
 
-                        if (sqrt(pow(pU.x - playerPos.x, 2) + pow(pU.y - playerPos.y, 2) + pow(pU.z - playerPos.z, 2)) < collisionDist) return true;
+    float forward = 0.0f, strafe = 0.0f;
 
-                    }
+    if (keyDown['w']) forward -= 1.0f;
 
-                    if (getNeighborValue(f, r + 1, c) == 1) { // Down
+    if (keyDown['s']) forward += 1.0f;
 
-                        Point3D pD = multiplyMatrixVector(getSpherePoint(f, (c + 0.5f) / N, (float)(r + 1) / N, planetRadius - 1.5f), planetRotationMatrix);
+    if (keyDown['a']) strafe -= 1.0f;
 
-                        if (sqrt(pow(pD.x - playerPos.x, 2) + pow(pD.y - playerPos.y, 2) + pow(pD.z - playerPos.z, 2)) < collisionDist) return true;
+    if (keyDown['d']) strafe += 1.0f;
 
-                    }
+    if (forward == 0.0f && strafe == 0.0f) return looked;
 
-                }
 
-            }
 
-        }
+    float step = MOVE_DEG_PER_SEC * (float)SIM_TICK / sqrt(forward * forward + strafe * strafe);
 
-    }
+    movePlayer(forward * step, strafe * step);
 
-    return false;
+    return true;
 
 }
 
 
 
-void checkInteraction() {
+// [߰]   ڷ 帥 ðŭ ƽ  ( ð  ),  ƽ 
 
-    Point3D pPos = { 0, -planetRadius + 1.5f, 0 };
+int advanceSimulation(double seconds) {
 
-    for (auto& item : items) {
+    simAccumulator += (seconds < SIM_MAX_FRAME) ? seconds : SIM_MAX_FRAME;
 
-        if (!item.active) continue;
+    int ticks = 0;
 
-        Point3D iPos = multiplyMatrixVector(getSpherePoint(item.face, (item.c + 0.5f) / N, (item.r + 0.5f) / N, planetRadius - 2), planetRotationMatrix);
+    while (simAccumulator >= SIM_TICK) {
 
-        if (sqrt(pow(iPos.x - pPos.x, 2) + pow(iPos.y - pPos.y, 2) + pow(iPos.z - pPos.z, 2)) < 4.0f) {
+        if (simulateTick()) redrawPending = true;
 
-            item.active = false; score += 100;
+        simAccumulator -= SIM_TICK;
 
-        }
+        ticks++;
 
     }
 
+    return ticks;
+
 }
 
 
 
-void movePlayer(float moveSpeed, float strafeSpeed) {
+// [߰]  : ð 缭 ùķ̼ , ٲ    ٽ ׸
 
-    float axisX = 0.0f, axisZ = 0.0f, angle = 0.0f;
+// glutPostRedisplay   ҷ  display   Ƿ ȭ Ŵ ƾ   ׸
 
-    float sinYaw = sin(cameraYaw), cosYaw = cos(cameraYaw);
+//    1ms  idle CPU   ʰ
 
+void idle() {
 
+    static std::chrono::steady_clock::time_point last = std::chrono::steady_clock::now();
 
-    if (moveSpeed != 0.0f) {
+    std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
 
-        axisX = cosYaw;
+    advanceSimulation(std::chrono::duration<double>(now - last).count());
 
-        axisZ = sinYaw;
+    last = now;
 
-        angle = moveSpeed;
+
+
+    if (redrawPending) {
+
+        redrawPending = false;
+
+        glutPostRedisplay();
 
     }
 
-    else if (strafeSpeed != 0.0f) {
+    else std::this_thread::sleep_for(std::chrono::milliseconds(1));
 
-        axisX = sinYaw;
+}
 
-        axisZ = -cosYaw;
 
-        angle = strafeSpeed;
 
-    }
+// [] ̵ Ű ¸  (glutIgnoreKeyRepeat Ű ݺ ̺Ʈ  ),     
 
+void keyboard(unsigned char key, int x, int y) {
 
+    keyDown[tolower(key)] = true;
 
-    if (angle == 0.0f) return;
 
 
+    if (key == 'v' || key == 'V') viewMode = !viewMode;
+
+    if (key == 'c' || key == 'C') cullingEnabled = !cullingEnabled;
+
+    if (key == 'r' || key == 'R') showRoute = !showRoute; // [߰]
+
+    if (key == ' ') checkInteraction();
+
+
+
+    if (key == 27) {
 
-    GLfloat bk[16]; for (int i = 0; i < 16; i++) bk[i] = planetRotationMatrix[i];
+        mouseCaptured = false;
 
-    glPushMatrix(); glLoadIdentity(); glRotatef(angle, axisX, 0.0f, axisZ);
+        glutSetCursor(GLUT_CURSOR_INHERIT);
 
-    glMultMatrixf(planetRotationMatrix); glGetFloatv(GL_MODELVIEW_MATRIX, planetRotationMatrix); glPopMatrix();
+        mouseLastX = mouseLastY = -1; // [߰] ٽ   Ǯ ִ    
 
+        mouseDX = mouseDY = 0;
 
+    }
 
-    if (checkCollision()) for (int i = 0; i < 16; i++) planetRotationMatrix[i] = bk[i];
+    redrawPending = true;
 
 }
 
 
 
-void keyboard(unsigned char key, int x, int y) {
+// [߰] Shift   ('W'  -> 'w' )  ĭ Ǯ ҹڷ
 
-    float speed = 1.5f;
+void keyboardUp(unsigned char key, int x, int y) {
 
-    if (key == 'w' || key == 'W') movePlayer(-speed, 0);
+    keyDown[tolower(key)] = false;
 
-    if (key == 's' || key == 'S') movePlayer(speed, 0);
+}
 
-    if (key == 'a' || key == 'A') movePlayer(0, -speed);
 
-    if (key == 'd' || key == 'D') movePlayer(0, speed);
 
+// [߰] ̵ ̺Ʈ ϳ  , ͸  ǵ ϸ true
 
+// ǵ ڿ ̺Ʈ ǵ ڸ()  ڸ     
 
-    if (key == 'v' || key == 'V') viewMode = !viewMode;
+// (ǵ  ̹ ׿ ִ ̺Ʈ  ڸ , ǵ  ̺Ʈʹ  )
 
-    if (key == ' ') checkInteraction();
+bool accumulateMouse(int x, int y) {
 
+    mouseEventsReceived++;
 
+    int centerX = winW / 2, centerY = winH / 2;
 
-    if (key == 27) {
+    if (mouseWarpWait > 0) {
 
-        mouseCaptured = false;
+        mouseWarpWait--;
 
-        glutSetCursor(GLUT_CURSOR_INHERIT);
+        int toCenter = abs(x - centerX) + abs(y - centerY), toLast = abs(x - mouseLastX) + abs(y - mouseLastY);
 
-    }
+        if (mouseLastX < 0 || toCenter <= toLast) { mouseLastX = centerX; mouseLastY = centerY; mouseWarpWait = 0; }
 
-    glutPostRedisplay();
+    }
 
-}
+    if (mouseLastX >= 0) { mouseDX += x - mouseLastX; mouseDY += y - mouseLastY; }
 
+    mouseLastX = x; mouseLastY = y;
 
 
-void mouseMotion(int x, int y) {
 
-    if (!mouseCaptured) return;
+    int margin = MOUSE_EDGE_MARGIN;
 
-    int centerX = winW / 2;
+    if (margin > winW / 4) margin = winW / 4;
 
-    int centerY = winH / 2;
+    if (margin > winH / 4) margin = winH / 4;
 
-    int dx = x - centerX;
+    return mouseWarpWait == 0 && (x < margin || x >= winW - margin || y < margin || y >= winH - margin);
 
-    int dy = y - centerY;
+}
 
-    if (dx == 0 && dy == 0) return;
 
 
+void recenterMouse() {
 
-    cameraYaw += dx * mouseSensitivity;
+    mouseWarpWait = 8;
 
-    cameraPitch -= dy * mouseSensitivity;
+    mouseWarps++;
 
+    glutWarpPointer(winW / 2, winH / 2);
 
+}
 
-    if (cameraPitch > 1.5f) cameraPitch = 1.5f;
 
-    if (cameraPitch < -1.5f) cameraPitch = -1.5f;
 
+// [] ̺Ʈ   ͸ ǵ ,  α⸸ ϰ ڸ ǵ
 
+void mouseMotion(int x, int y) {
 
-    glutWarpPointer(centerX, centerY);
+    if (!mouseCaptured) return;
 
-    glutPostRedisplay();
+    if (accumulateMouse(x, y)) recenterMouse();
 
 }
 
@@ -1344,7 +4118,7 @@ void mouseClick(int button, int state, int x, int y) {
 
             glutSetCursor(GLUT_CURSOR_NONE);
 
-            glutWarpPointer(winW / 2, winH / 2);
+            recenterMouse();
 
         }
 
@@ -1358,8 +4132,26 @@ void specialKeys(int key, int x, int y) {}
 
 
 
+// [߰] CubePlanetBench.cpp     main  
+
+#ifndef CUBE_PLANET_NO_MAIN
+
 int main(int argc, char** argv) {
 
+    // [߰] --map ξ: ξfront.csv ...  ٸ  Ʈ (ũ Ͽ )
+
+    // [߰] --agents K: ̷θ ȴ NPC 
+
+    for (int i = 1; i + 1 < argc; i++) if (strcmp(argv[i], "--map") == 0) mapPrefix = argv[i + 1];
+
+    for (int i = 1; i + 1 < argc; i++) if (strcmp(argv[i], "--agents") == 0) agentCount = atoi(argv[i + 1]);
+
+    unsigned cores = std::thread::hardware_concurrency();
+
+    agentJobs.start(cores > 1 ? (int)cores - 1 : 0); // [] initMap  ׷ ⿡ 
+
+
+
     glutInit(&argc, argv);
 
     glutInitDisplayMode(GLUT_DOUBLE | GLUT_RGB | GLUT_DEPTH);
@@ -1374,11 +4166,13 @@ int main(int argc, char** argv) {
 
 
 
-    makeCheckImage(0); makeCheckImage(1);
+    buildTextureAtlas(); // [] /ٴ Ʋ + Ӹ
 
     initMap();
 
-    loadModel("myModel.dat"); // ⺻  ε ( initMap ó)
+    spawnAgents(agentCount, 777u); // [߰]
+
+    if (agentCount == 0) agentJobs.stop(); // [] NPC     ϲ 
 
 
 
@@ -1388,6 +4182,12 @@ int main(int argc, char** argv) {
 
     glutKeyboardFunc(keyboard);
 
+    glutKeyboardUpFunc(keyboardUp); // [߰] Ű  ( )
+
+    glutIgnoreKeyRepeat(1);         // [߰]  ִ  ݺ ̺Ʈ 
+
+    glutIdleFunc(idle);             // [߰]  ð  ùķ̼ + ʿ  ٽ ׸
+
     glutPassiveMotionFunc(mouseMotion);
 
     glutMouseFunc(mouseClick);
@@ -1396,10 +4196,12 @@ int main(int argc, char** argv) {
 
 
 
-    glutWarpPointer(winW / 2, winH / 2);
+    recenterMouse();
 
     glutMainLoop();
 
     return 0;
 
-}
\ No newline at end of file
+}
+
+#endif
\ No newline at end of file
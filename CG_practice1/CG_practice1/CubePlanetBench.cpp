@@ -0,0 +1,827 @@
+// ----------------------------------------------------------
+// CubePlanet  α׷: â   ý۸ ª Ȯ ˻ + ǥ   
+//  ҽ(CubePlanet.cpp) main  ״ ؼ  ڵ带 ˻
+// : CubePlanetBench.exe [--max-n K]  (K ū   ǳʶ)
+//   mismatches 0 ƴϸ FAIL, ϳ ϸ  ڵ 1
+// ----------------------------------------------------------
+#define CUBE_PLANET_NO_MAIN
+#include "CubePlanet.cpp"
+#include <cstdarg>     // report (printf )
+
+typedef std::chrono::high_resolution_clock BenchClock;
+
+double elapsedMs(BenchClock::time_point t0) {
+    return std::chrono::duration<double, std::milli>(BenchClock::now() - t0).count();
+}
+
+volatile float benchSink = 0.0f; //   ȭ  ʰ
+int failedChecks = 0;
+
+// ˻  : ߳  0 ƴϸ з 
+void report(const char* tag, int mismatches, const char* fmt, ...) {
+    char detail[1024];
+    va_list args;
+    va_start(args, fmt);
+    vsnprintf(detail, sizeof(detail), fmt, args);
+    va_end(args);
+    printf("[%s] %s | mismatches %d%s\n", tag, detail, mismatches, mismatches ? "  FAIL" : "");
+    if (mismatches) failedChecks++;
+}
+
+//  (-1 ~ 1)
+float benchRandom(unsigned& seed) {
+    seed = seed * 1103515245u + 12345u;
+    return ((seed >> 8) & 0xFFFF) / 65535.0f * 2.0f - 1.0f;
+}
+
+//   ʹϾ ( ༺ )
+Quat benchRandomRotation(unsigned& seed) {
+    Quat q;
+    float len;
+    do {
+        q.x = benchRandom(seed); q.y = benchRandom(seed); q.z = benchRandom(seed); q.w = benchRandom(seed);
+        len = q.x * q.x + q.y * q.y + q.z * q.z + q.w * q.w;
+    } while (len > 1.0f || len < 1e-4f);
+    q.normalize();
+    return q;
+}
+
+// ----------------------------------------------------------
+// [ ] ӿ    (˻ θ )
+// ----------------------------------------------------------
+//  踶 resolveNeighbor Űܼ  (grid ׵θ 纻 ˻)
+int seamNeighborValue(int f, int r, int c) {
+    if (r >= 0 && r < N && c >= 0 && c < N) return grid.at(f, r, c);
+
+    int tf, tr, tc;
+    resolveNeighbor(f, r, c, tf, tr, tc);
+    return grid.at(tf, tr, tc);
+}
+
+// ĭ  +     (ģ  ޽ ũ )
+void emitSmartWall(std::vector<MeshVertex>& out, int f, int r, int c) {
+    int u1 = latIndex(c, LAT_EDGE); int u2 = latIndex(c + 1, LAT_EDGE);
+    int v1 = latIndex(r, LAT_EDGE); int v2 = latIndex(r + 1, LAT_EDGE);
+    int uc_s = latIndex(c, LAT_START); int uc_e = latIndex(c, LAT_END);
+    int vc_s = latIndex(r, LAT_START); int vc_e = latIndex(r, LAT_END);
+
+    int conn = wallBits.mask(f, r, c);
+    emitWallBox(out, f, uc_s, uc_e, vc_s, vc_e, WALL_ALL);
+    if (conn & WallBits::CONN_L) emitWallBox(out, f, u1, uc_s, vc_s, vc_e, WALL_ALL);
+    if (conn & WallBits::CONN_R) emitWallBox(out, f, uc_e, u2, vc_s, vc_e, WALL_ALL);
+    if (conn & WallBits::CONN_U) emitWallBox(out, f, uc_s, uc_e, v1, vc_s, WALL_ALL);
+    if (conn & WallBits::CONN_D) emitWallBox(out, f, uc_s, uc_e, vc_e, v2, WALL_ALL);
+}
+
+// ÷̾ ó ûũ(  )  ĭ   ǥ Űܼ Ÿ  (checkCollision ˻)
+bool checkCollisionScan() {
+    Point3D playerPos = { 0.0f, -planetRadius + 1.5f, 0.0f };
+    GLfloat m[16];
+    planetOrientation.toMatrix(m);
+    Point3D local = planetOrientation.applyInverse(playerPos);
+    float h = planetRadius - 1.5f;
+
+    for (int id = 0; id < chunkCount; id++) {
+        const WallChunk& ch = wallChunks[id];
+        float dx = local.x - ch.boundCenter.x, dy = local.y - ch.boundCenter.y, dz = local.z - ch.boundCenter.z;
+        float reach = ch.boundRadius + COLLISION_DIST;
+        if (dx * dx + dy * dy + dz * dz > reach * reach) continue;
+
+        int f, r0, r1, c0, c1;
+        chunkRect(id, f, r0, r1, c0, c1);
+        for (int r = r0; r < r1; r++)
+            for (int c = c0; c < c1; c++) {
+                if (!wallBits.isWall(f, r, c)) continue;
+                int conn = wallBits.mask(f, r, c);
+                int uc = latIndex(c, LAT_CENTER), vc = latIndex(r, LAT_CENTER);
+                const int pu[5] = { uc, latIndex(c, LAT_EDGE), latIndex(c + 1, LAT_EDGE), uc, uc };
+                const int pv[5] = { vc, vc, vc, latIndex(r, LAT_EDGE), latIndex(r + 1, LAT_EDGE) };
+                const int need[5] = { 0, WallBits::CONN_L, WallBits::CONN_R, WallBits::CONN_U, WallBits::CONN_D };
+                for (int k = 0; k < 5; k++) {
+                    if (need[k] && !(conn & need[k])) continue;
+                    Point3D p = multiplyMatrixVector(latticePoint(f, pu[k], pv[k], h), m);
+                    if (sqrt(pow(p.x - playerPos.x, 2) + pow(p.y - playerPos.y, 2) + pow(p.z - playerPos.z, 2)) < COLLISION_DIST) return true;
+                }
+            }
+    }
+    return false;
+}
+
+// ū ༺   : 4ĭ      ̷  (CSV 0 = )
+void writeGeneratedMap(const std::string& prefix, int n, unsigned seed) {
+    std::string line;
+    for (int i = 0; i < 6; i++) {
+        FILE* fp = fopen((prefix + CUBE_FACE_NAMES[i] + ".csv").c_str(), "w");
+        if (!fp) continue;
+        for (int r = 0; r < n; r++) {
+            line.clear();
+            for (int c = 0; c < n; c++) {
+                seed = seed * 1103515245u + 12345u;
+                bool wall = (r % 4 == 0 || c % 4 == 0) && ((r % 4 != 2 && c % 4 != 2) || ((seed >> 16) & 3) == 0);
+                line += wall ? '0' : '1';
+                line += (c + 1 < n) ? ',' : '\n';
+            }
+            fwrite(line.data(), 1, line.size(), fp);
+        }
+        fclose(fp);
+    }
+}
+
+void removeGeneratedMap(const std::string& prefix) {
+    for (int i = 0; i < 6; i++) remove((prefix + CUBE_FACE_NAMES[i] + ".csv").c_str());
+}
+
+// ----------------------------------------------------------
+// [ʰ  ˻]
+// ----------------------------------------------------------
+//   ĳ:  ǥ getSpherePoint  (1e-3 ), ޸𸮿 ȸ 
+void verifyLattice() {
+    ensureSphereLattice();
+    int S = lattice.stride, bad = 0;
+    float maxErr = 0.0f;
+    for (int f = 0; f < 6; f++)
+        for (int iv = 0; iv < S; iv++)
+            for (int iu = 0; iu < S; iu++) {
+                Point3D a = getSpherePoint(f, lattice.axis[iu] * 0.5f + 0.5f, lattice.axis[iv] * 0.5f + 0.5f, planetRadius);
+                Point3D b = latticePoint(f, iu, iv, planetRadius);
+                float err = fmax(fabs(a.x - b.x), fmax(fabs(a.y - b.y), fabs(a.z - b.z)));
+                maxErr = fmax(maxErr, err);
+                bad += (err > 1e-3f);
+            }
+
+    const int REPS = 100;
+    float sink = 0.0f;
+    BenchClock::time_point t0 = BenchClock::now();
+    for (int rep = 0; rep < REPS; rep++)
+        for (int f = 0; f < 6; f++)
+            for (int iv = 0; iv < S; iv++)
+                for (int iu = 0; iu < S; iu++) sink += latticePoint(f, iu, iv, planetRadius).x;
+    double ns = elapsedMs(t0) * 1e6 / ((double)REPS * 6 * S * S);
+    benchSink = sink;
+
+    size_t bytes = (lattice.axis.size() + lattice.invLen.size()) * sizeof(float);
+    report("Lattice", bad, "N=%d, %d samples/axis, %zu bytes | latticePoint %.2f ns/pt, max err %g", N, S, bytes, ns, maxErr);
+}
+
+// ༺ ȸ :      ( GL ð  )ε  ÷̾ ġ 
+// ʹϾ   ʾƾ  (1e-5 ), ġ ̴    (0.1 )
+void verifyOrientation(int steps) {
+    unsigned seed = 99u;
+    GLfloat m[16], rot[16], next[16], qm[16];
+    for (int i = 0; i < 16; i++) m[i] = (i % 5 == 0) ? 1.0f : 0.0f;
+    Quat q;
+    Point3D foot = { 0.0f, -BASE_RADIUS + 1.5f, 0.0f };
+    float maxDiff = 0.0f;
+    for (int k = 0; k < steps; k++) {
+        float yaw = benchRandom(seed) * M_PI, angle = 1.5f * benchRandom(seed);
+        mat4Rotate(angle, cos(yaw), 0.0f, sin(yaw), rot);
+        mat4Multiply(rot, m, next);
+        for (int i = 0; i < 16; i++) m[i] = next[i];
+        q.rotateWorld(angle, cos(yaw), 0.0f, sin(yaw));
+
+        Point3D a = { m[0] * foot.x + m[1] * foot.y + m[2] * foot.z, m[4] * foot.x + m[5] * foot.y + m[6] * foot.z,
+            m[8] * foot.x + m[9] * foot.y + m[10] * foot.z };
+        Point3D d = vec3Sub(a, q.applyInverse(foot));
+        maxDiff = fmax(maxDiff, sqrt(vec3Dot(d, d)));
+    }
+
+    // |M^T M - I|   ū 
+    q.toMatrix(qm);
+    float orthoErr = 0.0f;
+    for (int i = 0; i < 3; i++)
+        for (int j = 0; j < 3; j++) {
+            float dot = qm[i * 4] * qm[j * 4] + qm[i * 4 + 1] * qm[j * 4 + 1] + qm[i * 4 + 2] * qm[j * 4 + 2];
+            orthoErr = fmax(orthoErr, fabs(dot - ((i == j) ? 1.0f : 0.0f)));
+        }
+    report("Orientation", (orthoErr > 1e-5f) + (maxDiff > 0.1f), "%d steps | quaternion orthonormal error %.2e, max player position diff vs matrix %.4f units",
+        steps, orthoErr, maxDiff);
+}
+
+//  : 0.5  W       (30 / 60 / 144Hz / 鸲)  
+void verifyFrameLoop() {
+    const double SECONDS = 0.5 + SIM_TICK * 0.5; // ƽ 迡 ġ ʰ
+    float savedYaw = cameraYaw;
+    cameraYaw = 3.0f * M_PI / 8.0f; //    ڸ  Ʈ 
+    const double frameHz[4] = { 30.0, 60.0, 144.0, 0.0 }; // 0 = 8 ~ 40ms ̷ 鸲
+    Point3D first = { 0, 0, 0 };
+    float walked = 0.0f;
+    int bad = 0;
+    for (int k = 0; k < 4; k++) {
+        planetOrientation = Quat();
+        simAccumulator = 0.0;
+        unsigned seed = 5u;
+        keyDown['w'] = true;
+        for (double t = 0.0; t < SECONDS;) {
+            double dt = (frameHz[k] > 0.0) ? 1.0 / frameHz[k] : 0.024 + 0.016 * benchRandom(seed);
+            if (t + dt > SECONDS) dt = SECONDS - t;
+            advanceSimulation(dt);
+            t += dt;
+        }
+        keyDown['w'] = false;
+
+        Point3D end = playerLocalPosition();
+        if (k == 0) {
+            first = end;
+            Point3D d = vec3Sub(end, playerLocalPosition(Quat()));
+            walked = sqrt(vec3Dot(d, d));
+        }
+        Point3D d = vec3Sub(end, first);
+        bad += (vec3Dot(d, d) > 1e-8f);
+    }
+    report("FrameLoop", bad, "%.2f s of W at 30/60/144 Hz and jittered frames | walked %.1f units", SECONDS, walked);
+    planetOrientation = Quat();
+    simAccumulator = 0.0;
+    cameraYaw = savedYaw;
+}
+
+// 콺 : 1000Hz 콺 1   (Ʒ  )  
+// ƽ Ƽ    ̺Ʈ ٷ    (1e-3 )
+void verifyMouseLook(int pxPerSec) {
+    const int RATE = 1000;
+    float savedYaw = cameraYaw, savedPitch = cameraPitch;
+    int cx = winW / 2, cy = winH / 2;
+    auto wobble = [](int i) { return (i % 40 < 20) ? 1 : -1; }; // Ʒ 20px պ
+
+    float refYaw = 0.0f, refPitch = 0.0f;
+    cameraYaw = cameraPitch = 0.0f;
+    mouseLastX = mouseLastY = -1; mouseDX = mouseDY = 0; mouseWarpWait = 0;
+    mouseEventsReceived = mouseDeltasApplied = mouseWarps = 0;
+    simAccumulator = 0.0;
+    int px = cx, py = cy;
+    accumulateMouse(px, py);
+    double carry = 0.0;
+    for (int i = 0; i < RATE; i++) {
+        carry += (double)pxPerSec / RATE;
+        int dx = (int)carry, dy = wobble(i);
+        carry -= dx;
+        refYaw += dx * mouseSensitivity;
+        refPitch = fmin(1.5f, fmax(-1.5f, refPitch - dy * mouseSensitivity));
+
+        px += dx; py += dy;
+        if (accumulateMouse(px, py)) { // recenterMouse   (â Ƿ ǵ ̺Ʈ  )
+            mouseWarpWait = 8; mouseWarps++;
+            px = cx; py = cy;
+            accumulateMouse(px, py);
+        }
+        if ((i + 1) % (RATE / 60) == 0) advanceSimulation(1.0 / 60.0);
+    }
+    advanceSimulation(SIM_TICK);
+
+    int bad = (fabs(cameraYaw - refYaw) > 1e-3f) + (fabs(cameraPitch - refPitch) > 1e-3f);
+    report("MouseLook", bad, "%d px/s at %d Hz | %lld events, %lld applied, %lld warps | yaw diff %.6f, pitch diff %.6f",
+        pxPerSec, RATE, mouseEventsReceived, mouseDeltasApplied, mouseWarps, fabs(cameraYaw - refYaw), fabs(cameraPitch - refPitch));
+
+    mouseLastX = mouseLastY = -1; mouseDX = mouseDY = 0; mouseWarpWait = 0;
+    mouseEventsReceived = mouseDeltasApplied = mouseWarps = 0;
+    simAccumulator = 0.0;
+    cameraYaw = savedYaw; cameraPitch = savedPitch;
+}
+
+// ƼƼ :  ȣ 7  count      
+//  id ĭ ȣ <-> id ° ġ /  ״,  id ,    ڸ   
+void verifyEntityStore(int count) {
+    unsigned seed = 4242u;
+    EntityStore store;
+    std::vector<Point3D> ref(count);
+    std::vector<int> ids(count);
+    std::vector<char> alive(count, 1);
+    store.reserve(count);
+    for (int i = 0; i < count; i++) {
+        ref[i] = vec3Scale(normalize(Point3D{ benchRandom(seed), benchRandom(seed), benchRandom(seed) }), planetRadius);
+        ids[i] = store.create(i % 7);
+        int s = store.slot(ids[i]);
+        store.posX[s] = ref[i].x; store.posY[s] = ref[i].y; store.posZ[s] = ref[i].z;
+    }
+    std::vector<int> order(count);
+    for (int i = 0; i < count; i++) order[i] = i;
+    for (int i = count - 1; i > 0; i--) std::swap(order[i], order[(int)((benchRandom(seed) * 0.5f + 0.5f) * i)]);
+    for (int i = 0; i < count / 2; i++) { store.destroy(ids[order[i]]); alive[order[i]] = 0; }
+
+    int bad = (store.size() != count - count / 2);
+    for (int i = 0; i < count; i++) {
+        if (!alive[i]) { bad += store.alive(ids[i]); continue; }
+        int s = store.slot(ids[i]);
+        bad += (s < 0 || store.entityAt[s] != ids[i] || store.model[s] != i % 7
+            || store.posX[s] != ref[i].x || store.posY[s] != ref[i].y || store.posZ[s] != ref[i].z);
+    }
+    for (int m = 0; m < store.modelCount(); m++)
+        for (int s = store.modelBegin(m); s < store.modelEnd(m); s++) bad += (store.model[s] != m);
+    bad += (store.modelEnd(store.modelCount() - 1) != store.size());
+
+    // ̴ ݱ ˻   (ġ 迭 )
+    Point3D view = normalize(Point3D{ 0.3f, -1.0f, 0.2f });
+    float minDot = planetRadius * 0.5f;
+    int visible = 0;
+    BenchClock::time_point t0 = BenchClock::now();
+    const float* xs = store.posX.data(); const float* ys = store.posY.data(); const float* zs = store.posZ.data();
+    for (int s = 0, n = store.size(); s < n; s++) visible += (xs[s] * view.x + ys[s] * view.y + zs[s] * view.z > minDot);
+    double us = elapsedMs(t0) * 1000.0;
+    report("Entities", bad, "%d created, %d left, %.1f MB | visible pass %.1f us (%d visible)",
+        count, store.size(), store.memoryBytes() / 1048576.0, us, visible);
+}
+
+// ----------------------------------------------------------
+// [ʺ ˻]  ҷ  (N) 
+// ----------------------------------------------------------
+//  ޽: ĭ ڿ ̾  ġ ũ ( )
+void measureWallMerge() {
+    std::vector<MeshVertex> before, after;
+    for (int f = 0; f < 6; f++)
+        for (int r = 0; r < N; r++)
+            for (int c = 0; c < N; c++)
+                if (grid.at(f, r, c) == 1) emitSmartWall(before, f, r, c);
+    for (int id = 0; id < chunkCount; id++) {
+        int f, r0, r1, c0, c1;
+        chunkRect(id, f, r0, r1, c0, c1);
+        emitMergedWalls(after, f, r0, r1, c0, c1);
+    }
+    printf("[WallMerge] N=%4d | per-cell boxes %zu quads, merged runs %zu quads (%.1f%%)\n",
+        N, before.size() / 4, after.size() / 4, 100.0 * after.size() / (before.empty() ? 1 : before.size()));
+}
+
+//  ũ:  Ʈ    ĭ getNeighborValue 4 
+void verifyConnMasks() {
+    BenchClock::time_point t0 = BenchClock::now();
+    for (int f = 0; f < 6; f++) wallBits.computeRows(f, 0, N, outsideWall);
+    double ms = elapsedMs(t0);
+
+    int bad = 0;
+    for (int f = 0; f < 6; f++)
+        for (int r = 0; r < N; r++)
+            for (int c = 0; c < N; c++) {
+                int m = 0;
+                if (grid.at(f, r, c) == 1) {
+                    if (getNeighborValue(f, r, c - 1) == 1) m |= WallBits::CONN_L;
+                    if (getNeighborValue(f, r, c + 1) == 1) m |= WallBits::CONN_R;
+                    if (getNeighborValue(f, r - 1, c) == 1) m |= WallBits::CONN_U;
+                    if (getNeighborValue(f, r + 1, c) == 1) m |= WallBits::CONN_D;
+                }
+                bad += (wallBits.mask(f, r, c) != m);
+            }
+    report("WallBits", bad, "N=%4d | %.2f MB, masks from word ops %.2f ms", N, wallBits.memoryBytes() / 1048576.0, ms);
+}
+
+// grid ׵θ:   ׵θ ĭ   ǥ Ű   
+void verifyHalo() {
+    int bad = 0;
+    for (int f = 0; f < 6; f++)
+        for (int i = -1; i <= N; i++) {
+            const int pr[4] = { -1, N, i, i };
+            const int pc[4] = { i, i, -1, N };
+            for (int k = 0; k < 4; k++) bad += (getNeighborValue(f, pr[k], pc[k]) != seamNeighborValue(f, pr[k], pc[k]));
+        }
+    report("Halo", bad, "N=%4d | %d border cells vs seam table", N, 6 * 4 * (N + 2));
+}
+
+// 浹 ˻: ༺   samples   ֺ ĭ   ûũ ȱ 
+void verifyCollision(int samples) {
+    unsigned seed = 777u;
+    std::vector<Quat> rots(samples);
+    for (int i = 0; i < samples; i++) rots[i] = benchRandomRotation(seed);
+
+    std::vector<char> local(samples);
+    BenchClock::time_point t0 = BenchClock::now();
+    for (int i = 0; i < samples; i++) { planetOrientation = rots[i]; local[i] = checkCollision(); }
+    double ms = elapsedMs(t0) / samples;
+
+    int hits = 0, bad = 0;
+    for (int i = 0; i < samples; i++) {
+        planetOrientation = rots[i];
+        bool scan = checkCollisionScan();
+        hits += scan; bad += (scan != (local[i] != 0));
+    }
+    planetOrientation = Quat();
+    report("Collision", bad, "N=%4d | %d orientations, %d blocked, %.4f ms/query", N, samples, hits, ms);
+}
+
+//  ̵:    ڸ   stepUnitsŭ ȱ
+//  ĸ   , ̲  ĸ ȿ   ߳
+void verifySweep(int samples, float stepUnits) {
+    unsigned seed = 4242u;
+    float angle = stepUnits / planetRadius * 180.0f / M_PI, progress = 0.0f;
+    int contacts = 0, inside = 0;
+    double ms = 0.0;
+    for (int i = 0; i < samples; i++) {
+        Quat start;
+        do start = benchRandomRotation(seed); while (insideWallCapsules(playerLocalPosition(start), COLLISION_DIST));
+        float yaw = benchRandom(seed) * M_PI;
+        Quat moved = start;
+        moved.rotateWorld(angle, cos(yaw), 0.0f, sin(yaw));
+        Point3D from = playerLocalPosition(start);
+        SweepHit hit;
+        if (!sweepWalls(from, playerLocalPosition(moved), hit)) continue; //   
+        contacts++;
+
+        planetOrientation = start;
+        BenchClock::time_point t0 = BenchClock::now();
+        stepPlanet(angle, cos(yaw), sin(yaw));
+        ms += elapsedMs(t0);
+        Point3D end = playerLocalPosition();
+        inside += insideWallCapsules(end, COLLISION_DIST - 0.01f);
+        Point3D d = vec3Sub(end, from);
+        progress += sqrt(vec3Dot(d, d)) / stepUnits;
+    }
+    planetOrientation = Quat();
+    report("Sweep", inside, "N=%4d | step %.1f units, %d wall contacts, progress %.0f%%, %.2f us/step",
+        N, stepUnits, contacts, 100.0f * progress / std::max(contacts, 1), ms * 1000.0 / std::max(contacts, 1));
+}
+
+//  ݱ:  ĭ count  queries  (  ٷ  )
+// ĭ  ã     ǥ Ű    (ó /  ֿ )
+//   ( WIDE_DIST, ĭ  )   (ֺ ĭ Ž ĭ  ѵ  )
+void verifyItems(int count, int queries) {
+    EntityStore savedItems;
+    std::swap(savedItems, items);
+    unsigned seed = 31337u;
+    auto rndCell = [&]() { return (int)((benchRandom(seed) * 0.5f + 0.5f) * (N - 1) + 0.5f); };
+
+    items.reserve(count);
+    for (int i = 0; i < count; i++) {
+        int s = items.slot(items.create());
+        items.face[s] = (int)((benchRandom(seed) * 0.5f + 0.5f) * 5.999f);
+        items.row[s] = rndCell(); items.col[s] = rndCell();
+        computeItemMatrix(s);
+    }
+    BenchClock::time_point t0 = BenchClock::now();
+    rebuildItemIndex();
+    double msBuild = elapsedMs(t0);
+
+    //  ڸ: ༺  (÷̾ ߹   ǵ)
+    std::vector<Quat> rots(queries);
+    Point3D down = { 0.0f, -1.0f, 0.0f };
+    for (int q = 0; q < queries; q++) {
+        if (q % 2 == 0) { rots[q] = benchRandomRotation(seed); continue; }
+        int s = (int)((benchRandom(seed) * 0.5f + 0.5f) * (count - 1));
+        Point3D p = normalize(Point3D{ items.posX[s] + 3.0f * benchRandom(seed), items.posY[s] + 3.0f * benchRandom(seed), items.posZ[s] + 3.0f * benchRandom(seed) });
+        Point3D axis = vec3Cross(p, down);
+        float deg = atan2(sqrt(vec3Dot(axis, axis)), vec3Dot(p, down)) * 180.0f / M_PI;
+        rots[q] = Quat::axisAngle(deg, axis.x, axis.y, axis.z);
+    }
+
+    Point3D pPos = { 0, -planetRadius + 1.5f, 0 };
+    auto scanCount = [&](float dist) { //  checkInteraction  
+        int found = 0;
+        items.forEach([&](int s) {
+            Point3D iPos = planetOrientation.apply(Point3D{ items.posX[s], items.posY[s], items.posZ[s] });
+            if (sqrt(pow(iPos.x - pPos.x, 2) + pow(iPos.y - pPos.y, 2) + pow(iPos.z - pPos.z, 2)) < dist) found++;
+        });
+        return found;
+    };
+    auto indexCount = [&](float dist) {
+        int found = 0;
+        forEachItemNear(playerLocalPosition(), dist, [&](int) { found++; });
+        return found;
+    };
+    const float WIDE_DIST = 120.0f;
+    const int WIDE_QUERIES = 20;
+
+    std::vector<int> indexed(queries);
+    t0 = BenchClock::now();
+    for (int q = 0; q < queries; q++) { planetOrientation = rots[q]; indexed[q] = indexCount(ITEM_PICKUP_DIST); }
+    double usQuery = elapsedMs(t0) * 1000.0 / queries;
+    int hits = 0, bad = 0;
+    for (int q = 0; q < queries; q++) { planetOrientation = rots[q]; int n = scanCount(ITEM_PICKUP_DIST); hits += n; bad += (n != indexed[q]); }
+    int wideHits = 0;
+    for (int q = 0; q < WIDE_QUERIES; q++) { planetOrientation = rots[q]; int n = scanCount(WIDE_DIST); wideHits += n; bad += (n != indexCount(WIDE_DIST)); }
+
+    std::vector<int> order(count);
+    for (int i = 0; i < count; i++) order[i] = i;
+    for (int i = count - 1; i > 0; i--) std::swap(order[i], order[(int)((benchRandom(seed) * 0.5f + 0.5f) * i)]);
+    for (int i = 0; i < count / 2; i++) { itemIndex.remove(order[i]); items.destroy(order[i]); }
+    for (int q = 0; q < queries; q++) { planetOrientation = rots[q]; bad += (scanCount(ITEM_PICKUP_DIST) != indexCount(ITEM_PICKUP_DIST)); }
+
+    report("Items", bad, "N=%4d | %d items, index %.2f MB, build %.2f ms | pickup query %.2f us, %d hits, radius %.0f: %d hits",
+        N, count, itemIndex.memoryBytes() / 1048576.0, msBuild, usQuery, hits, WIDE_DIST, wideHits);
+    planetOrientation = Quat();
+    std::swap(items, savedItems);
+    rebuildItemIndex();
+}
+
+// ȴ : count ticksƽ Ȱ ϸ ó (ms  Ʈ )
+// ó 1 ھ ŭ (ھ    ,    ̶ Ȯ强  ƴ)
+// ˻: 4   ġ 1 Ʈ   (ھ  ),  ĭ ְų  ĭ  Ʈ 
+void verifyAgents(int count, int ticks) {
+    const int SPLIT_THREADS = 4;
+    int cores = (int)std::max(1u, std::thread::hardware_concurrency());
+    std::vector<float> reference;
+    std::string rates;
+    int bad = 0, leftFace = 0;
+    const int runs[3] = { 1, cores, SPLIT_THREADS };
+    for (int k = 0; k < 3; k++) {
+        int threads = runs[k];
+        if (k == 1 && cores == 1) continue;
+        spawnAgents(count, 2024u);
+        std::vector<int> startFace = agents.curFace;
+        JobSystem pool;
+        pool.start(threads - 1);
+        BenchClock::time_point t0 = BenchClock::now();
+        for (int t = 0; t < ticks; t++)
+            pool.parallelFor(agents.size(), AGENT_BATCH, [](int begin, int end) { updateAgents(begin, end, (float)SIM_TICK); });
+        double ms = elapsedMs(t0);
+        if (k < 2) {
+            char rate[48];
+            sprintf(rate, " %d thread%s %.0f/ms", threads, threads > 1 ? "s" : "", (double)agents.size() * ticks / ms);
+            rates += rate;
+        }
+
+        if (reference.empty()) {
+            reference = agents.pos;
+            for (int i = 0; i < agents.size(); i++) {
+                bad += !agentWalkable(agents.curFace[i], agents.curRow[i], agents.curCol[i])
+                    || !agentWalkable(agents.nextFace[i], agents.nextRow[i], agents.nextCol[i]);
+                leftFace += (agents.curFace[i] != startFace[i]);
+            }
+        }
+        else {
+            for (int i = 0; i < agents.size(); i++)
+                bad += (memcmp(&agents.pos[(size_t)i * 3], &reference[(size_t)i * 3], sizeof(float) * 3) != 0);
+        }
+    }
+    report("Agents", bad, "N=%4d | %d agents, %d ticks, %d cores |%s | %.2f MB, left start face %d, %d-thread split checked",
+        N, count, ticks, cores, rates.c_str(), agents.memoryBytes() / 1048576.0, leftFace, SPLIT_THREADS);
+    agents.clear();
+}
+
+//  ã: A* ΰ ͽƮ (޸ƽ 0)  ,  ̿ ĭ  ׷ 
+// Ǵ   16ĭ  () ƹ  ĭ (), checks ͽƮ ٽ ã
+void verifyPath(int queries, int checks) {
+    BenchClock::time_point t0 = BenchClock::now();
+    buildMazeGraph();
+    double msBuild = elapsedMs(t0);
+    int nodes = mazeGraph.nodeCount();
+    if (nodes == 0) { report("Path", 0, "N=%4d | no open cells", N); return; }
+
+    unsigned seed = 8080u;
+    auto rnd = [&](int bound) { return (int)((benchRandom(seed) * 0.5f + 0.5f) * (bound - 1) + 0.5f); };
+    std::vector<int> path, check;
+    int bad = 0;
+    double usQuery[2] = { 0.0, 0.0 };
+    for (int far = 0; far < 2; far++) {
+        double ms = 0.0;
+        for (int q = 0; q < queries; q++) {
+            int start = rnd(nodes), goal = rnd(nodes);
+            if (!far) {
+                int f, r, c;
+                mazeGraph.cellOf(start, f, r, c);
+                do goal = mazeGraph.node(f, std::min(N - 1, std::max(0, r + rnd(33) - 16)), std::min(N - 1, std::max(0, c + rnd(33) - 16)));
+                while (goal < 0);
+            }
+            float aCost, dCost;
+            t0 = BenchClock::now();
+            bool found = pathFinder.route(mazeGraph, start, goal, path, aCost) >= 0;
+            ms += elapsedMs(t0);
+            if (q >= checks) continue;
+
+            bool foundRef = pathFinder.search(mazeGraph, start, [goal](int v) { return v == goal; }, [](int) { return 0.0f; }, check, dCost) >= 0;
+            if (found != foundRef || (found && fabsf(aCost - dCost) > 1e-3f * std::max(dCost, 1.0f))) { bad++; continue; }
+            for (size_t k = 1; k < path.size(); k++) {
+                bool linked = false;
+                for (int e = mazeGraph.edgeStart[path[k - 1]]; e < mazeGraph.edgeStart[path[k - 1] + 1]; e++) linked = linked || mazeGraph.edgeTo[e] == path[k];
+                bad += !linked;
+            }
+        }
+        usQuery[far] = ms * 1000.0 / queries;
+    }
+    report("Path", bad, "N=%4d | %d nodes, %d regions, %.1f MB, build %.1f ms | A* near %.1f us, far %.1f us (%d each, %d vs Dijkstra)",
+        N, nodes, mazeGraph.componentCount, (mazeGraph.memoryBytes() + pathFinder.memoryBytes()) / 1048576.0, msBuild,
+        usQuery[0], usQuery[1], queries, std::min(queries, checks));
+}
+
+//   ã (HPA*): ̾   ƹ  ĭ  ĭ ΰ  ʰ  -> 
+// ó flatChecks ׷ ü A*   (ġ HIER_PATH_WEIGHT    )
+// ״ setMapCell ĭ edits ٲٸ ģ  ׷ 4 ó ٽ  Ͱ Ŭ /   (verify )
+//  ó agentJobs (ھ ŭ),  ð   븸 / ĭ α 
+void verifyHierPath(int queries, int flatChecks, int edits, bool verify) {
+    const int SPLIT_THREADS = 4;
+    int cores = (int)std::max(1u, std::thread::hardware_concurrency());
+    agentJobs.start(cores - 1);
+    BenchClock::time_point t0 = BenchClock::now();
+    buildHierPath();
+    double msBuild = elapsedMs(t0);
+    agentJobs.stop();
+
+    unsigned seed = 5150u;
+    auto rnd = [&](int bound) { return (int)((benchRandom(seed) * 0.5f + 0.5f) * (bound - 1) + 0.5f); };
+    std::vector<CubeCell> starts, goals, cells;
+    for (int tries = 0; (int)starts.size() < queries && tries < queries * 100; tries++) {
+        int a = rnd(mazeGraph.nodeCount()), b = rnd(mazeGraph.nodeCount());
+        if (!mazeGraph.connected(a, b)) continue;
+        CubeCell s, g;
+        mazeGraph.cellOf(a, s.f, s.r, s.c);
+        mazeGraph.cellOf(b, g.f, g.r, g.c);
+        starts.push_back(s); goals.push_back(g);
+    }
+    int count = (int)starts.size(), bad = 0, across = 0;
+    float cost;
+    for (int q = 0; q < count; q++)
+        across += !hierPath.nearRegions(hierPath.regionOf(hierPath.clusterOf(starts[q])), hierPath.regionOf(hierPath.clusterOf(goals[q])));
+    t0 = BenchClock::now();
+    for (int q = 0; q < count; q++) hierPath.route(starts[q], goals[q], cells, cost, false);
+    double msAbstract = elapsedMs(t0) / std::max(count, 1);
+    t0 = BenchClock::now();
+    for (int q = 0; q < count; q++) hierPath.route(starts[q], goals[q], cells, cost);
+    double msQuery = elapsedMs(t0) / std::max(count, 1);
+
+    std::vector<int> flatPath;
+    double maxRatio = 1.0;
+    for (int q = 0; q < count; q++) {
+        CubeCell s = starts[q], g = goals[q];
+        hierPath.route(s, g, cells, cost);
+        if (cells.empty() || cells.front().f != s.f || cells.front().r != s.r || cells.front().c != s.c
+            || cells.back().f != g.f || cells.back().r != g.r || cells.back().c != g.c) { bad++; continue; }
+        float arcLen = 0.0f;
+        for (size_t k = 1; k < cells.size(); k++) {
+            int a = mazeGraph.node(cells[k - 1].f, cells[k - 1].r, cells[k - 1].c), b = mazeGraph.node(cells[k].f, cells[k].r, cells[k].c);
+            bool linked = false;
+            for (int e = (a >= 0) ? mazeGraph.edgeStart[a] : 0; a >= 0 && e < mazeGraph.edgeStart[a + 1]; e++) linked = linked || mazeGraph.edgeTo[e] == b;
+            if (!linked) { bad++; break; }
+            arcLen += mazeGraph.arc(a, b);
+        }
+        if (q < flatChecks) {
+            float flatCost;
+            pathFinder.route(mazeGraph, mazeGraph.node(s.f, s.r, s.c), mazeGraph.node(g.f, g.r, g.c), flatPath, flatCost);
+            if (flatCost > 0.0f) maxRatio = std::max(maxRatio, (double)arcLen / flatCost);
+        }
+    }
+
+    // ĭ ġ: Ӱ  setMapCell ( Ʈ / Ÿ /  ׷  ħ),  ǵ
+    std::vector<CubeCell> edited;
+    t0 = BenchClock::now();
+    for (int e = 0; e < edits; e++) {
+        CubeCell p = { rnd(6), rnd(N), rnd(N) };
+        edited.push_back(p);
+        setMapCell(p.f, p.r, p.c, grid.at(p.f, p.r, p.c) == 1 ? 0 : 1);
+    }
+    double usEdit = elapsedMs(t0) * 1000.0 / std::max(edits, 1);
+    if (verify) {
+        HierPath fresh;
+        JobSystem pool;
+        pool.start(SPLIT_THREADS - 1);
+        fresh.build(N, [](int f, int r, int c) { return wallBits.isWall(f, r, c); }, &pool);
+        for (size_t cl = 0; cl < fresh.clusters.size(); cl++) {
+            const HierPath::Cluster& a = hierPath.clusters[cl];
+            const HierPath::Cluster& b = fresh.clusters[cl];
+            bool same = a.cells == b.cells && a.dist == b.dist && a.upper == b.upper && a.regionPart == b.regionPart && a.toUpper == b.toUpper
+                && a.out.size() == b.out.size();
+            for (size_t t = 0; same && t < a.out.size(); t++)
+                same = a.out[t].from == b.out[t].from && a.out[t].toCluster == b.out[t].toCluster && a.out[t].toCell == b.out[t].toCell
+                    && a.out[t].to == b.out[t].to && a.out[t].cost == b.out[t].cost && a.out[t].upper == b.out[t].upper;
+            bad += !same;
+        }
+        for (size_t rx = 0; rx < fresh.regions.size(); rx++)
+            bad += !(hierPath.regions[rx].nodes == fresh.regions[rx].nodes && hierPath.regions[rx].dist == fresh.regions[rx].dist);
+    }
+    for (int e = edits - 1; e >= 0; e--) {
+        const CubeCell& p = edited[e];
+        setMapCell(p.f, p.r, p.c, grid.at(p.f, p.r, p.c) == 1 ? 0 : 1);
+    }
+    report("HPA", bad, "N=%4d | %d clusters, %d entrances / %d regions, %d entrances, %.1f MB, build %.1f ms (%d thread%s) | "
+        "%d queries (%d on region level) abstract %.3f ms, refined %.3f ms, up to %.1f%% longer than A* | map edit %.1f us%s",
+        N, (int)hierPath.clusters.size(), hierPath.nodeCount(), (int)hierPath.regions.size(), hierPath.regionNodeCount(),
+        hierPath.memoryBytes() / 1048576.0, msBuild, cores, cores > 1 ? "s" : "",
+        count, across, msAbstract, msQuery, (maxRatio - 1.0) * 100.0, usEdit, verify ? ", edits vs 4-thread rebuild checked" : "");
+    hierPath = HierPath(); //  ˻    ׷ ġ ʰ
+}
+
+//  Ÿ: ĭ edits ٲٸ ģ  ó ٽ   
+// refCheck ׵θ    ǥθ 8 ȭ    
+void verifyWallDistance(bool refCheck, int edits) {
+    BenchClock::time_point t0 = BenchClock::now();
+    wallDistance.build(wallBits);
+    double msBuild = elapsedMs(t0);
+
+    int bad = 0;
+    if (refCheck) {
+        PlanetGrid built = wallDistance.dist;
+        for (int f = 0; f < 6; f++)
+            for (int r = 0; r < N; r++)
+                for (int c = 0; c < N; c++) wallDistance.dist.at(f, r, c) = wallBits.isWall(f, r, c) ? 0 : WallDistance::FAR_VALUE;
+        bool changed = true;
+        while (changed) {
+            changed = false;
+            for (int f = 0; f < 6; f++)
+                for (int r = 0; r < N; r++)
+                    for (int c = 0; c < N; c++) changed = wallDistance.relaxAll(f, r, c) | changed;
+        }
+        for (int f = 0; f < 6; f++)
+            for (int r = 0; r < N; r++)
+                for (int c = 0; c < N; c++) bad += (built.at(f, r, c) != wallDistance.dist.at(f, r, c));
+        wallDistance.dist = built;
+    }
+
+    //  ĭ  <-> ĭ ٲ ( ڸ ĭ     ŵ Ȯ)
+    unsigned seed = 4242u;
+    auto rnd = [&](int n) { seed = seed * 1103515245u + 12345u; return (int)((seed >> 8) % (unsigned)n); };
+    std::vector<CubeCell> changedCells;
+    t0 = BenchClock::now();
+    for (int i = 0; i < edits; i++) {
+        CubeCell k = { rnd(6), rnd(N), rnd(N) };
+        if (i % 3 == 0) k.r = (rnd(2) == 0) ? 0 : N - 1;
+        setMapCell(k.f, k.r, k.c, grid.at(k.f, k.r, k.c) == 1 ? 0 : 1);
+        changedCells.push_back(k);
+    }
+    double msUpdate = elapsedMs(t0) / std::max(edits, 1);
+
+    PlanetGrid updated = wallDistance.dist;
+    wallDistance.build(wallBits);
+    for (int f = 0; f < 6; f++)
+        for (int r = 0; r < N; r++)
+            for (int c = 0; c < N; c++) bad += (updated.at(f, r, c) != wallDistance.dist.at(f, r, c));
+    for (int i = (int)changedCells.size() - 1; i >= 0; i--) {
+        const CubeCell& k = changedCells[i];
+        setMapCell(k.f, k.r, k.c, grid.at(k.f, k.r, k.c) == 1 ? 0 : 1);
+    }
+    report("WallDist", bad, "N=%4d | build %.1f ms (%d passes), %.1f MB, update %.3f ms/edit%s",
+        N, msBuild, wallDistance.passes, wallDistance.dist.memoryBytes() / 1048576.0, msUpdate, refCheck ? ", reference checked" : "");
+}
+
+// N ε ð   CPU  (ø + ó ̴ ûũ ޽  + 浹 ˻)
+void measurePlanet(double msLoad) {
+    planetOrientation = Quat();
+    planetOrientation.toMatrix(planetRotationMatrix);
+    float projM[16], viewM[16];
+    float eyeY = -planetRadius + playerHeight;
+    mat4Perspective(60.0f, 1.5f, 0.1f, 1000.0f, projM);
+    mat4LookAt({ 0, eyeY, 0 }, { 0, eyeY, -1 }, { 0, 1, 0 }, viewM);
+    setCullFrustum(projM, viewM, planetRotationMatrix);
+
+    const int FRAMES = 20;
+    int visible = 0;
+    BenchClock::time_point t0 = BenchClock::now();
+    for (int k = 0; k < FRAMES; k++) {
+        visible = 0;
+        for (int id = 0; id < chunkCount; id++)
+            if (sphereInFrustum(wallChunks[id].boundCenter, wallChunks[id].boundRadius)) visible++;
+    }
+    double msCull = elapsedMs(t0) / FRAMES;
+
+    std::vector<MeshVertex> verts;
+    t0 = BenchClock::now();
+    for (int id = 0; id < chunkCount; id++) {
+        if (!sphereInFrustum(wallChunks[id].boundCenter, wallChunks[id].boundRadius)) continue;
+        int f, r0, r1, c0, c1;
+        chunkRect(id, f, r0, r1, c0, c1);
+        emitMergedWalls(verts, f, r0, r1, c0, c1);
+    }
+    double msBake = elapsedMs(t0);
+
+    t0 = BenchClock::now();
+    for (int k = 0; k < FRAMES; k++) benchSink = checkCollision();
+    double msCollide = elapsedMs(t0) / FRAMES;
+
+    printf("[Planet] N=%4d R=%7.1f | load %8.1f ms, grid %6.1f MB | chunks %6d x %2d^2, visible %4d | cull %.3f ms, collision %.3f ms, first bake %.1f ms (%zu quads)\n",
+        N, planetRadius, msLoad, grid.memoryBytes() / 1048576.0, chunkCount, chunkSize, visible, msCull, msCollide, msBake, verts.size() / 4);
+}
+
+//   (N = 15)  ū ʸ ʺ ˻縦  
+void verifyPlanetSizes(int maxN) {
+    const int sizes[] = { BASE_N, 256, 512, 1024, 2048 };
+    std::string shippedPrefix = mapPrefix;
+    for (int n : sizes) {
+        if (n > maxN) break;
+        bool small = (n == BASE_N);
+        mapPrefix = small ? shippedPrefix : std::string("bench_map_");
+        if (!small) writeGeneratedMap(mapPrefix, n, 1234u);
+
+        BenchClock::time_point t0 = BenchClock::now();
+        std::streambuf* old = std::cout.rdbuf(nullptr); // 鸶  α״ 
+        loadMapFaces();
+        std::cout.rdbuf(old);
+        double msLoad = elapsedMs(t0);
+        if (!small) removeGeneratedMap(mapPrefix);
+
+        measurePlanet(msLoad);
+        if (small) measureWallMerge();
+        verifyConnMasks();
+        verifyHalo();
+        verifyCollision(small ? 20000 : 1000);
+        verifySweep(small ? 5000 : 1000, 12.0f);
+        verifyItems(50000, small ? 2000 : 500);
+        verifyAgents(small ? 5000 : 100000, small ? 600 : 60);
+        verifyPath(small ? 2000 : 200, small ? 500 : (n <= 512) ? 20 : 4);
+        verifyHierPath(small ? 2000 : 200, (n <= 512) ? 20 : 3, 200, n <= 512);
+        verifyWallDistance(n <= 512, 200);
+    }
+    mapPrefix = shippedPrefix;
+}
+
+int main(int argc, char** argv) {
+    int maxN = 1 << 30;
+    for (int i = 1; i + 1 < argc; i++) if (strcmp(argv[i], "--max-n") == 0) maxN = atoi(argv[i + 1]);
+    for (int i = 1; i + 1 < argc; i++) if (strcmp(argv[i], "--map") == 0) mapPrefix = argv[i + 1];
+
+    std::streambuf* old = std::cout.rdbuf(nullptr);
+    loadMapFaces(); // ʰ  ˻絵    ڸ (    ʰ)
+    std::cout.rdbuf(old);
+
+    verifyLattice();
+    verifyOrientation(1000000);
+    verifyFrameLoop();
+    verifyMouseLook(300);
+    verifyMouseLook(3000);
+    verifyEntityStore(300000);
+    verifyPlanetSizes(maxN);
+
+    printf("%s: %d check(s) failed\n", failedChecks ? "FAIL" : "OK", failedChecks);
+    return failedChecks ? 1 : 0;
+}
@@ -0,0 +1,222 @@
+#pragma once
+// ----------------------------------------------------------
+// [ť ] 6  (U, V, Z )    ǥ    
+//    = U * x + V * y + Z   (x =  , y =  , -1 ~ 1)
+// -   Ѿ ǥ (      )
+// - CSV ȸ ǥ (90 )
+// getSpherePoint / getCubePoint   Ἥ ׸ ̿ Ģ ߳ 
+// ----------------------------------------------------------
+
+enum { FACE_FRONT = 0, FACE_BACK = 1, FACE_RIGHT = 2, FACE_LEFT = 3, FACE_TOP = 4, FACE_BOTTOM = 5 };
+
+struct CubeAxis { int x, y, z; };
+struct CubeFrame { CubeAxis u, v, z; };
+
+constexpr CubeFrame CUBE_FRAMES[6] = {
+    { { -1, 0, 0 }, { 0, 1, 0 }, { 0, 0, -1 } }, // FRONT  (Z-)
+    { { 1, 0, 0 },  { 0, 1, 0 }, { 0, 0, 1 } },  // BACK   (Z+)
+    { { 0, 0, -1 }, { 0, 1, 0 }, { 1, 0, 0 } },  // RIGHT  (X+)
+    { { 0, 0, 1 },  { 0, 1, 0 }, { -1, 0, 0 } }, // LEFT   (X-)
+    { { 1, 0, 0 },  { 0, 0, -1 }, { 0, 1, 0 } }, // TOP    (Y+)
+    { { 1, 0, 0 },  { 0, 0, 1 }, { 0, -1, 0 } }, // BOTTOM (Y-)
+};
+
+// 鸶 CSV  ̸    
+constexpr const char* CUBE_FACE_NAMES[6] = { "front", "back", "right", "left", "top", "bottom" };
+constexpr int CUBE_CSV_ANGLES[6] = { 180, 0, 90, -90, 0, 0 };
+
+//  f (x, y) 3D  (z =  Ÿ)
+template <typename P>
+inline P cubeFacePoint(int f, float x, float y, float z) {
+    const CubeFrame& F = CUBE_FRAMES[f];
+    P p = {
+        F.u.x * x + F.v.x * y + F.z.x * z,
+        F.u.y * x + F.v.y * y + F.z.y * z,
+        F.u.z * x + F.v.z * y + F.z.z * z
+    };
+    return p;
+}
+
+// cubeFacePoint ݴ:  p ( ߽   )    ǥ x, y (-1 ~ 1)
+//  = p    ,  ǥ = (pU, pV) / pZ
+template <typename P>
+inline void cubeFaceCoords(const P& p, int& f, float& x, float& y) {
+    f = 0;
+    float bestZ = -1e30f;
+    for (int k = 0; k < 6; k++) {
+        const CubeAxis& z = CUBE_FRAMES[k].z;
+        float d = z.x * p.x + z.y * p.y + z.z * p.z;
+        if (d > bestZ) { bestZ = d; f = k; }
+    }
+    const CubeFrame& F = CUBE_FRAMES[f];
+    x = (F.u.x * p.x + F.u.y * p.y + F.u.z * p.z) / bestZ;
+    y = (F.v.x * p.x + F.v.y * p.y + F.v.z * p.z) / bestZ;
+}
+
+//  p  ĭ
+template <typename P>
+inline void cubeCellOf(const P& p, int n, int& f, int& r, int& c) {
+    float x, y;
+    cubeFaceCoords(p, f, x, y);
+    c = (int)((x + 1.0f) * 0.5f * n);
+    r = (int)((y + 1.0f) * 0.5f * n);
+    c = (c < 0) ? 0 : (c >= n) ? n - 1 : c;
+    r = (r < 0) ? 0 : (r >= n) ? n - 1 : r;
+}
+
+// ----------------------------------------------------------
+// [  ǥ]  f (r < 0) / Ʒ(r >= N) / (c < 0) / (c >= N) 
+//   face  = rA * i + rB * (N - 1),  = cA * i + cB * (N - 1)
+// i 踦 󰡴 ǥ (/Ʒ  c, /̸  r)
+// ----------------------------------------------------------
+enum { SEAM_UP = 0, SEAM_DOWN = 1, SEAM_LEFT = 2, SEAM_RIGHT = 3 };
+
+struct SeamRule { int face, rA, rB, cA, cB; };
+struct SeamTable { SeamRule rule[6][4]; };
+struct CubeCell { int f, r, c; };
+
+constexpr int cubeDot(CubeAxis a, CubeAxis b) { return a.x * b.x + a.y * b.y + a.z * b.z; }
+constexpr CubeAxis cubeNeg(CubeAxis a) { return { -a.x, -a.y, -a.z }; }
+
+//    ϳ  (edge)  i, ݴ N-1-i,
+//   (from)  N-1 ( ), ݴ 0
+constexpr SeamRule makeSeamCoord(SeamRule s, bool row, CubeAxis axis, CubeAxis edge, CubeAxis from) {
+    int e = cubeDot(axis, edge);
+    int b = (e < 0 || cubeDot(axis, from) > 0) ? 1 : 0;
+    if (row) { s.rA = e; s.rB = b; }
+    else { s.cA = e; s.cB = b; }
+    return s;
+}
+
+constexpr SeamRule makeSeamRule(int f, int side) {
+    const CubeFrame& F = CUBE_FRAMES[f];
+    CubeAxis out = (side == SEAM_UP) ? cubeNeg(F.v) : (side == SEAM_DOWN) ? F.v : (side == SEAM_LEFT) ? cubeNeg(F.u) : F.u;
+    CubeAxis edge = (side == SEAM_UP || side == SEAM_DOWN) ? F.u : F.v;
+
+    SeamRule s = { 0, 0, 0, 0, 0 };
+    for (int k = 0; k < 6; k++) if (cubeDot(CUBE_FRAMES[k].z, out) == 1) s.face = k; //     
+    s = makeSeamCoord(s, true, CUBE_FRAMES[s.face].v, edge, F.z);
+    s = makeSeamCoord(s, false, CUBE_FRAMES[s.face].u, edge, F.z);
+    return s;
+}
+
+constexpr SeamTable makeSeamTable() {
+    SeamTable t = {};
+    for (int f = 0; f < 6; f++)
+        for (int side = 0; side < 4; side++) t.rule[f][side] = makeSeamRule(f, side);
+    return t;
+}
+
+constexpr SeamTable CUBE_SEAMS = makeSeamTable();
+
+//   ǥ (r Ǵ c -1 / N) ̿  ĭ, ̸ ״
+// 𼭸 (  )   Ģ     ڸ ( resolveNeighbor )
+constexpr CubeCell cubeSeamCell(int f, int r, int c, int n) {
+    if (r >= 0 && r < n && c >= 0 && c < n) return { f, r, c };
+    int side = (r < 0) ? SEAM_UP : (r >= n) ? SEAM_DOWN : (c < 0) ? SEAM_LEFT : SEAM_RIGHT;
+    const SeamRule& s = CUBE_SEAMS.rule[f][side];
+    int i = (side <= SEAM_DOWN) ? c : r;
+    int tr = s.rA * i + s.rB * (n - 1);
+    int tc = s.cA * i + s.cB * (n - 1);
+    tr = (tr < 0) ? 0 : (tr >= n) ? n - 1 : tr;
+    tc = (tc < 0) ? 0 : (tc >= n) ? n - 1 : tc;
+    return { s.face, tr, tc };
+}
+
+// N    :   ĭ  ĭ ̸  ǥ [][][ ǥ] (6 x 4 x N)
+template <int N>
+struct SeamCellTable { CubeCell cell[6][4][N]; };
+
+template <int N>
+constexpr SeamCellTable<N> makeSeamCellTable() {
+    SeamCellTable<N> t = {};
+    for (int f = 0; f < 6; f++)
+        for (int i = 0; i < N; i++) {
+            t.cell[f][SEAM_UP][i] = cubeSeamCell(f, -1, i, N);
+            t.cell[f][SEAM_DOWN][i] = cubeSeamCell(f, N, i, N);
+            t.cell[f][SEAM_LEFT][i] = cubeSeamCell(f, i, -1, N);
+            t.cell[f][SEAM_RIGHT][i] = cubeSeamCell(f, i, N, N);
+        }
+    return t;
+}
+
+template <int N>
+constexpr SeamCellTable<N> CUBE_SEAM_CELLS = makeSeamCellTable<N>();
+
+// ǥ д cubeSeamCell (𼭸   ǥ   ߶  ڸ Ͱ )
+template <int N>
+constexpr CubeCell cubeSeamCellN(int f, int r, int c) {
+    if (r >= 0 && r < N && c >= 0 && c < N) return { f, r, c };
+    int side = (r < 0) ? SEAM_UP : (r >= N) ? SEAM_DOWN : (c < 0) ? SEAM_LEFT : SEAM_RIGHT;
+    int i = (side <= SEAM_DOWN) ? c : r;
+    i = (i < 0) ? 0 : (i >= N) ? N - 1 : i;
+    return CUBE_SEAM_CELLS<N>.cell[f][side][i];
+}
+
+// :    ĭ   ,  ĭ    ٽ  ڸ
+template <int N>
+constexpr bool cubeSeamsRoundTrip() {
+    for (int f = 0; f < 6; f++)
+        for (int side = 0; side < 4; side++)
+            for (int i = 0; i < N; i++) {
+                int r = (side == SEAM_UP) ? -1 : (side == SEAM_DOWN) ? N : i;
+                int c = (side == SEAM_LEFT) ? -1 : (side == SEAM_RIGHT) ? N : i;
+                CubeCell from = cubeSeamCell(f, (r < 0) ? 0 : (r >= N) ? N - 1 : r, (c < 0) ? 0 : (c >= N) ? N - 1 : c, N);
+                CubeCell to = cubeSeamCellN<N>(f, r, c);
+                bool back = false;
+                const int dr[4] = { -1, 1, 0, 0 };
+                const int dc[4] = { 0, 0, -1, 1 };
+                for (int k = 0; k < 4; k++) {
+                    CubeCell b = cubeSeamCellN<N>(to.f, to.r + dr[k], to.c + dc[k]);
+                    if (b.f == from.f && b.r == from.r && b.c == from.c) back = true;
+                }
+                if (!back) return false;
+            }
+    return true;
+}
+static_assert(cubeSeamsRoundTrip<4>(), "cube seam table is not symmetric");
+static_assert(cubeSeamsRoundTrip<15>(), "cube seam table is not symmetric");
+
+// : ǥ      ĭ ׵θ ü (𼭸 ) cubeSeamCell 
+template <int N>
+constexpr bool cubeSeamCellsMatch() {
+    for (int f = 0; f < 6; f++)
+        for (int r = -1; r <= N; r++)
+            for (int c = -1; c <= N; c++) {
+                CubeCell a = cubeSeamCellN<N>(f, r, c), b = cubeSeamCell(f, r, c, N);
+                if (a.f != b.f || a.r != b.r || a.c != b.c) return false;
+            }
+    return true;
+}
+static_assert(cubeSeamCellsMatch<4>() && cubeSeamCellsMatch<15>(), "seam cell table differs from cubeSeamCell");
+
+// ----------------------------------------------------------
+// [CSV ȸ ǥ]  (, )  (, )
+//  = rr * row + rc * col + rk * (N - 1),   
+// 90 ȸ (row, col) -> (col, N-1-row)  0 ~ 3 ļ 
+// ----------------------------------------------------------
+struct GridRotation { int rr, rc, rk, cr, cc, ck; };
+
+constexpr GridRotation rotateGrid90(GridRotation g) {
+    return { g.cr, g.cc, g.ck, -g.rr, -g.rc, 1 - g.rk };
+}
+
+struct GridRotationTable { GridRotation rot[4]; };
+
+constexpr GridRotationTable makeGridRotations() {
+    GridRotationTable t = {};
+    t.rot[0] = { 1, 0, 0, 0, 1, 0 };
+    for (int k = 1; k < 4; k++) t.rot[k] = rotateGrid90(t.rot[k - 1]);
+    return t;
+}
+
+constexpr GridRotationTable GRID_ROTATIONS = makeGridRotations();
+
+// angle 90  ( )
+constexpr const GridRotation& gridRotation(int angle) {
+    return GRID_ROTATIONS.rot[((angle / 90) % 4 + 4) % 4];
+}
+
+static_assert(GRID_ROTATIONS.rot[1].rc == 1 && GRID_ROTATIONS.rot[1].cr == -1 && GRID_ROTATIONS.rot[1].ck == 1, "90 degree rotation");
+static_assert(rotateGrid90(GRID_ROTATIONS.rot[3]).rr == 1 && rotateGrid90(GRID_ROTATIONS.rot[3]).cc == 1
+    && rotateGrid90(GRID_ROTATIONS.rot[3]).rk == 0 && rotateGrid90(GRID_ROTATIONS.rot[3]).ck == 0, "four rotations are identity");
\ No newline at end of file
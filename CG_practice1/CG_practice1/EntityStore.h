@@ -0,0 +1,143 @@
+#pragma once
+// ----------------------------------------------------------
+// [ƼƼ ]  / ֿ  / Ʈ Ʈ 迭 (ü 迭  迭 ü)
+//  ִ ƼƼ ڸ 0 ~ size()-1  ϰ  
+// ->   active  б  ʿ 迭 ʷ  (ĳ / SIMD )
+// ƼƼ ȣ(id)   ְ ٲ , ڸ(slot) ų   ٲ  
+// [] ڸ  ȣ    ( m = ڸ modelBegin(m) ~ modelEnd(m)-1)
+// -> ׸  𵨸   غϰ   ʷ ׸ ( )
+// - create :  m   ڸ ϳ  id  (  ù ڸ  ű, O( ))
+// - destroy:    ڸ  ڸ ű,    ڸ  ĭ  (O( ))
+// - forEach:  ִ ڸ fn(slot)
+// model[s]    (ٲٷ  ٽ )
+// ----------------------------------------------------------
+#include <vector>
+#include <cstddef>
+
+struct EntityStore {
+    // Ʈ (ڸ )
+    std::vector<int> face, row, col;           //  ĭ
+    std::vector<float> posX, posY, posZ;       // ༺  ǥ ġ
+    std::vector<int> model;                    //  ȣ ()
+    std::vector<float> colorR, colorG, colorB;
+    std::vector<float> rotation;               // ڸ ȸ  ()
+    std::vector<float> transform;              // ڸ 16, ġ//ũ⸦ ģ  (glMultMatrixf)
+
+    std::vector<int> entityAt; // ڸ -> id
+    std::vector<int> slotOf;   // id -> ڸ (-1 = )
+    std::vector<int> modelEnds; // 𵨸   ڸ + 1 ( m  modelEnds[m-1] ~ modelEnds[m]-1)
+
+    int size() const { return (int)entityAt.size(); }
+    int idCount() const { return (int)slotOf.size(); }
+    bool alive(int id) const { return id >= 0 && id < idCount() && slotOf[id] >= 0; }
+    int slot(int id) const { return slotOf[id]; }
+    int modelCount() const { return (int)modelEnds.size(); }
+    int modelBegin(int m) const { return (m == 0) ? 0 : modelEnds[m - 1]; }
+    int modelEnd(int m) const { return modelEnds[m]; }
+
+    void clear() {
+        face.clear(); row.clear(); col.clear();
+        posX.clear(); posY.clear(); posZ.clear();
+        model.clear();
+        colorR.clear(); colorG.clear(); colorB.clear();
+        rotation.clear();
+        transform.clear();
+        entityAt.clear(); slotOf.clear();
+        modelEnds.clear();
+    }
+
+    void reserve(int count) {
+        face.reserve(count); row.reserve(count); col.reserve(count);
+        posX.reserve(count); posY.reserve(count); posZ.reserve(count);
+        model.reserve(count);
+        colorR.reserve(count); colorG.reserve(count); colorB.reserve(count);
+        rotation.reserve(count);
+        transform.reserve((size_t)count * 16);
+        entityAt.reserve(count); slotOf.reserve(count);
+    }
+
+    // Ʈ 0 ( , transform  ) ä 
+    int create(int modelIndex = 0) {
+        if (modelIndex >= modelCount()) modelEnds.resize(modelIndex + 1, size());
+        int id = idCount();
+        int hole = size();
+        slotOf.push_back(hole);
+        entityAt.push_back(id);
+        face.push_back(0); row.push_back(0); col.push_back(0);
+        posX.push_back(0.0f); posY.push_back(0.0f); posZ.push_back(0.0f);
+        model.push_back(modelIndex);
+        colorR.push_back(1.0f); colorG.push_back(1.0f); colorB.push_back(1.0f);
+        rotation.push_back(0.0f);
+        for (int i = 0; i < 16; i++) transform.push_back((i % 5 == 0) ? 1.0f : 0.0f);
+
+        //   ù ڸ  ڸ (   ) Űܼ  ڸ  
+        for (int m = modelCount() - 1; m > modelIndex; m--) {
+            int first = modelBegin(m);
+            if (first != hole) moveEntity(first, hole);
+            hole = first;
+            modelEnds[m]++;
+        }
+        modelEnds[modelIndex]++;
+        if (hole != size() - 1) { // ű   ڸ  ƼƼ
+            resetSlot(hole, modelIndex);
+            entityAt[hole] = id;
+            slotOf[id] = hole;
+        }
+        return id;
+    }
+
+    void destroy(int id) {
+        if (!alive(id)) return;
+        int hole = slotOf[id];
+        //    ڸ, ״    ڸ  ڸ Űܼ  ڸ   
+        for (int m = model[hole]; m < modelCount(); m++) {
+            int last = modelEnds[m] - 1; //  ̸ last == hole (ű  )
+            if (last != hole) moveEntity(last, hole);
+            hole = last;
+            modelEnds[m]--;
+        }
+        int last = size() - 1;
+        face.pop_back(); row.pop_back(); col.pop_back();
+        posX.pop_back(); posY.pop_back(); posZ.pop_back();
+        model.pop_back();
+        colorR.pop_back(); colorG.pop_back(); colorB.pop_back();
+        rotation.pop_back();
+        transform.resize((size_t)last * 16);
+        entityAt.pop_back();
+        slotOf[id] = -1;
+    }
+
+    template <typename Fn>
+    void forEach(Fn fn) const {
+        for (int s = 0, n = size(); s < n; s++) fn(s);
+    }
+
+    size_t memoryBytes() const {
+        return (size_t)size() * (sizeof(int) * 5 + sizeof(float) * 7 + sizeof(float) * 16) + slotOf.size() * sizeof(int);
+    }
+
+private:
+    template <typename T>
+    static void moveSlot(std::vector<T>& v, int from, int to) { v[to] = v[from]; }
+
+    // ڸ from ƼƼ ڸ to (to ִ  )
+    void moveEntity(int from, int to) {
+        moveSlot(face, from, to); moveSlot(row, from, to); moveSlot(col, from, to);
+        moveSlot(posX, from, to); moveSlot(posY, from, to); moveSlot(posZ, from, to);
+        moveSlot(model, from, to);
+        moveSlot(colorR, from, to); moveSlot(colorG, from, to); moveSlot(colorB, from, to);
+        moveSlot(rotation, from, to);
+        for (int i = 0; i < 16; i++) transform[(size_t)to * 16 + i] = transform[(size_t)from * 16 + i];
+        entityAt[to] = entityAt[from];
+        slotOf[entityAt[to]] = to;
+    }
+
+    void resetSlot(int s, int modelIndex) {
+        face[s] = row[s] = col[s] = 0;
+        posX[s] = posY[s] = posZ[s] = 0.0f;
+        model[s] = modelIndex;
+        colorR[s] = colorG[s] = colorB[s] = 1.0f;
+        rotation[s] = 0.0f;
+        for (int i = 0; i < 16; i++) transform[(size_t)s * 16 + i] = (i % 5 == 0) ? 1.0f : 0.0f;
+    }
+};
\ No newline at end of file
@@ -0,0 +1,812 @@
+#pragma once
+// ----------------------------------------------------------
+// [  ã] ū ༺ HPA*:  C x C ĭ (Ŭ)   ׷ 
+// - Ա: ̿ ŬͿ ´ (  )  ĭ    
+//            (LONG_RUNĭ ̸̻    ),  ŬͰ    
+// - Ŭ  : Ա ĭ Ŭ ȿ  ִ  ̸  (Ա  x Ա  ǥ)
+// - [߰] 2ܰ: Ŭ regionSide x regionSide   (鸶  REGIONS_PER_SIDE x REGIONS_PER_SIDE )
+//         ٸ  ǳʰ  (ǳ ,   ȿ ̾ ) REGION_DOORS ø   Ա  Ա
+//          Ա   1ܰ ׷   ̸  ( Ա ǥ + Ŭ Ա  Ա ǥ)
+// - : / ĭ ڱ Ŭ Ա հ,  ̸ 1ܰ ׷ A*
+//         ´  1ܰ,  ָ ǥ  Ա  ̾ 2ܰ ׷ A*
+//         ->    1ܰ A*, Ŭ   ĭ A* ĭ θ ä
+// - ĭ ϳ ġ  ĭ ´ ŬͿ  ̿   ٽ  (ü  ȣ Ƿ  ״)
+// - build JobSystem ָ Ŭ /   ϲ۵鿡  (Ž ۾   )
+//  ĭ  ( , getSpherePoint  )   Ÿ (̿ ĭ ̿ ȣ ̿  )
+//  ׷  ζ ִ κ    
+// ----------------------------------------------------------
+#include <vector>
+#include <cstdint>
+#include <cmath>
+#include <algorithm>
+#include <utility>
+#include "CubeTopology.h"
+#include "JobSystem.h"
+
+struct HierPath {
+    static const int C = 32;            // Ŭ   (ĭ),   32Ʈ ϳ 
+    static const int MAX_NODES = 4 * C; // Ŭʹ Ա ִ (׵θ ĭ )
+    static const int LONG_RUN = 6;
+    static const int MIN_REGION_SIDE = 4;  //    (Ŭ) ּ
+    static const int REGIONS_PER_SIDE = 8; //      ̺   Ű (2ܰ   ༺ ũ  ϰ)
+    static const int REGION_DOORS = 4;     // ̿  ϳ (̾   ϳ) ø   ( 2ܰ谡 ۾ δ , 2  40% )
+    static const int BUILD_BATCH = 16;     // ϲ    Ŭ /  
+    static_assert(C <= 32 && 64 % C == 0, "cluster row must fit in one 32-bit word");
+
+    struct Vec3 { float x, y, z; };
+    // from / to: Ա ȣ, toCell: ǳ ĭ (Ŭ  ȣ), upper: 2ܰ迡 ø   
+    struct Transition { int from, toCluster, toCell, to; float cost; bool upper; };
+    struct Cluster {
+        std::vector<int> cells;      // Ա -> Ŭ  ĭ ȣ ((r - r0) * C + (c - c0))
+        std::vector<float> pos;      // Ա ĭ  (3)
+        std::vector<float> dist;     // Ա  x Ա , Ŭ ȿ   (  INF)
+        std::vector<Transition> out; // ̿ Ŭͷ ǳʰ  (from )
+        std::vector<int> outStart;   // Ա out  ڸ (Ա  + 1)
+        std::vector<int> upper;      // Ա ->  Ա ȣ ( Ա ƴϸ -1)
+        std::vector<int> regionPart; // Ա ->  ȿ ̾  ̸ (      ȣ)
+        std::vector<float> toUpper;  // Ա  x  Ա ,  ȿ   (  INF)
+        int region = 0, slot = 0;    //   /   ڸ (regionOf / regionSlot)
+    };
+    struct Region {
+        std::vector<int> nodes;      //  Ա (1ܰ ȣ = Ŭ * MAX_NODES + Ա)
+        std::vector<float> dist;     //  Ա  x  Ա ,  ȿ   (  INF)
+        std::vector<int> near;       // ¿ ´  (  ʸ ,   ó  )
+    };
+    struct OpenEntry { float f; int id; };
+
+    int n = 0, k = 0, regionSide = MIN_REGION_SIDE, kr = 0; //    ĭ  / Ŭ  /    Ŭ  /  
+    int wordsPerRow = 0;
+    std::vector<uint64_t> open; // [][][]  ĭ Ʈ
+    std::vector<Cluster> clusters;
+    std::vector<Region> regions;
+    int expanded = 0;           //  ǿ     ( ٸ 2ܰ )
+    int updatedClusters = 0;    //  update ٽ  Ŭ 
+    float weight = 1.0f;        //  ׷ / ġ A* ޸ƽ  (1 =  ׷  ִ, ũ    ΰ  )
+
+    static float infinity() { return 1e30f; }
+
+    bool isOpen(int f, int r, int c) const { return (open[((size_t)f * n + r) * wordsPerRow + (c >> 6)] >> (c & 63)) & 1; }
+    bool isOpen(CubeCell p) const { return isOpen(p.f, p.r, p.c); }
+    int clusterOf(int f, int r, int c) const { return (f * k + r / C) * k + c / C; }
+    int clusterOf(CubeCell p) const { return clusterOf(p.f, p.r, p.c); }
+    int localCell(CubeCell p) const { return (p.r % C) * C + p.c % C; }
+    long long cellKey(CubeCell p) const { return ((long long)p.f * n + p.r) * n + p.c; }
+
+    int regionOf(int cl) const { return (cl / (k * k) * kr + cl / k % k / regionSide) * kr + cl % k / regionSide; }
+    int regionSlot(int cl) const { return (cl / k % k % regionSide) * regionSide + cl % k % regionSide; } //   Ŭ ڸ
+    //  rx slot° Ŭ ( ̸ -1)
+    int regionCluster(int rx, int slot) const {
+        int f = rx / (kr * kr), cr = rx / kr % kr * regionSide + slot / regionSide, cc = rx % kr * regionSide + slot % regionSide;
+        return (cr < k && cc < k) ? (f * k + cr) * k + cc : -1;
+    }
+
+    void clusterRect(int cl, int& f, int& r0, int& r1, int& c0, int& c1) const {
+        f = cl / (k * k);
+        r0 = (cl / k % k) * C; c0 = (cl % k) * C;
+        r1 = std::min(r0 + C, n); c1 = std::min(c0 + C, n);
+    }
+
+    CubeCell cellAt(int cl, int l) const {
+        int f, r0, r1, c0, c1;
+        clusterRect(cl, f, r0, r1, c0, c1);
+        return { f, r0 + l / C, c0 + l % C };
+    }
+
+    // getSpherePoint(f, (c + 0.5) / n, (r + 0.5) / n, 1)  
+    void center(int f, int r, int c, float* out) const {
+        Vec3 p = cubeFacePoint<Vec3>(f, ((c + 0.5f) / n - 0.5f) * 2.0f, ((r + 0.5f) / n - 0.5f) * 2.0f, 1.0f);
+        float inv = 1.0f / sqrtf(p.x * p.x + p.y * p.y + p.z * p.z);
+        out[0] = p.x * inv; out[1] = p.y * inv; out[2] = p.z * inv;
+    }
+
+    static float chord(const float* a, const float* b) {
+        float dx = a[0] - b[0], dy = a[1] - b[1], dz = a[2] - b[2];
+        return sqrtf(dx * dx + dy * dy + dz * dz);
+    }
+
+    // jobs  Ŭ /   ϲ۵鿡  ( ܰ ȿ ڱ Ŭ /  )
+    template <typename IsWall>
+    void build(int size, IsWall isWall, JobSystem* jobs = nullptr) {
+        n = size;
+        k = (n + C - 1) / C;
+        regionSide = std::max(MIN_REGION_SIDE, (k + REGIONS_PER_SIDE - 1) / REGIONS_PER_SIDE);
+        kr = (k + regionSide - 1) / regionSide;
+        wordsPerRow = (n + 63) >> 6;
+        open.assign((size_t)6 * n * wordsPerRow, 0);
+        auto fillRows = [&](int begin, int end) { // ึ ٸ 常 
+            for (int row = begin; row < end; row++)
+                for (int c = 0; c < n; c++)
+                    if (!isWall(row / n, row % n, c)) open[(size_t)row * wordsPerRow + (c >> 6)] |= (uint64_t)1 << (c & 63);
+        };
+        if (jobs) jobs->parallelFor(6 * n, 64, fillRows); else fillRows(0, 6 * n);
+
+        clusters.assign((size_t)6 * k * k, Cluster());
+        regions.assign((size_t)6 * kr * kr, Region());
+        int count = (int)clusters.size(), regionCount = (int)regions.size();
+        for (int cl = 0; cl < count; cl++) { clusters[cl].region = regionOf(cl); clusters[cl].slot = regionSlot(cl); }
+        forEachParallel(jobs, regionCount, [this](Scratch&, int rx) { linkRegions(rx); });
+        forEachParallel(jobs, count, [this](Scratch&, int cl) { buildEntrances(cl); });
+        forEachParallel(jobs, count, [this](Scratch&, int cl) { resolveTransitions(cl); });
+        forEachParallel(jobs, count, [this](Scratch& s, int cl) { buildDistances(s, cl); });
+        forEachParallel(jobs, regionCount, [this](Scratch&, int rx) { buildParts(rx); });
+        forEachParallel(jobs, regionCount, [this](Scratch&, int rx) { selectUpper(rx); });
+        forEachParallel(jobs, regionCount, [this](Scratch& s, int rx) { buildRegion(s, rx); });
+
+        work = Scratch();
+        size_t ids = clusters.size() * MAX_NODES;
+        ag.assign(ids, 0.0f); aparent.assign(ids, -1); aseen.assign(ids, 0); aclosed.assign(ids, 0); astamp = 0;
+    }
+
+    // ĭ ϳ  ǰų  :  ĭ ¿ ̿ ĭ Ŭ͸ ٽ , ٽ  Ŭ 
+    int update(int f, int r, int c, bool wall) {
+        uint64_t& w = open[((size_t)f * n + r) * wordsPerRow + (c >> 6)];
+        uint64_t bit = (uint64_t)1 << (c & 63);
+        if (wall) w &= ~bit; else w |= bit;
+        work.cluster = -1;
+
+        const int dr[4] = { -1, 1, 0, 0 };
+        const int dc[4] = { 0, 0, -1, 1 };
+        std::vector<int> touched(1, clusterOf(f, r, c));
+        for (int d = 0; d < 4; d++) {
+            int cl = clusterOf(cubeSeamCell(f, r + dr[d], c + dc[d], n));
+            if (std::find(touched.begin(), touched.end(), cl) == touched.end()) touched.push_back(cl);
+        }
+        for (int cl : touched) buildEntrances(cl);
+        // ٲ Ŭ Ա ȣ Ű ̿鵵 ٽ ã (Ա   Ƿ ̿ = ǳʰ Ŭ)
+        std::vector<int> resolve = touched;
+        for (int cl : touched)
+            for (const Transition& t : clusters[cl].out)
+                if (std::find(resolve.begin(), resolve.end(), t.toCluster) == resolve.end()) resolve.push_back(t.toCluster);
+        for (int cl : resolve) resolveTransitions(cl);
+        for (int cl : touched) buildDistances(work, cl);
+        //  Ŭ͵    ٽ . ̿    ٲ  (  Ƿ)
+        std::vector<int> touchedRegions, nearRegions;
+        auto addOnce = [](std::vector<int>& list, int v) { if (std::find(list.begin(), list.end(), v) == list.end()) list.push_back(v); };
+        for (int cl : resolve) addOnce(touchedRegions, clusters[cl].region);
+        for (int rx : touchedRegions) buildParts(rx);
+        for (int rx : touchedRegions)
+            for (int slot = 0; slot < regionSide * regionSide; slot++) {
+                int cl = regionCluster(rx, slot);
+                if (cl < 0) continue;
+                for (const Transition& t : clusters[cl].out)
+                    if (std::find(touchedRegions.begin(), touchedRegions.end(), clusters[t.toCluster].region) == touchedRegions.end())
+                        addOnce(nearRegions, clusters[t.toCluster].region);
+            }
+        for (int rx : touchedRegions) { selectUpper(rx); buildRegion(work, rx); }
+        for (int rx : nearRegions)
+            if (selectUpper(rx)) buildRegion(work, rx);
+        updatedClusters = (int)touched.size();
+        return updatedClusters;
+    }
+
+    // s -> g ĭ  (path s g ), refine false   븸 (path )
+    bool route(CubeCell s, CubeCell g, std::vector<CubeCell>& path, float& cost, bool refine = true) {
+        path.clear(); cost = 0.0f; expanded = 0;
+        if (!isOpen(s) || !isOpen(g)) return false;
+        int cs = clusterOf(s), cg = clusterOf(g), ls = localCell(s), lgl = localCell(g);
+
+        //  /  ĭ ڱ Ŭ Ա
+        entranceCosts(cs, ls, startCost);
+        entranceCosts(cg, lgl, goalCost);
+        if (nearRegions(regionOf(cs), regionOf(cg))) return routeClusters(s, g, path, cost, refine);
+        return routeRegions(s, g, path, cost, refine);
+    }
+
+    //  ̰ų ´  ( ̸ 밢 ):    Ա ư  Ƿ 1ܰ迡 ã
+    bool nearRegions(int a, int b) const {
+        if (a / (kr * kr) == b / (kr * kr) && std::abs(a / kr % kr - b / kr % kr) <= 1 && std::abs(a % kr - b % kr) <= 1) return true;
+        const std::vector<int>& near = regions[a].near;
+        return std::find(near.begin(), near.end(), b) != near.end();
+    }
+
+    int nodeCount() const {
+        int count = 0;
+        for (const Cluster& X : clusters) count += (int)X.cells.size();
+        return count;
+    }
+
+    int regionNodeCount() const {
+        int count = 0;
+        for (const Region& R : regions) count += (int)R.nodes.size();
+        return count;
+    }
+
+    size_t memoryBytes() const {
+        size_t bytes = open.size() * sizeof(uint64_t) + clusters.size() * sizeof(Cluster) + regions.size() * sizeof(Region)
+            + ag.size() * (sizeof(float) + sizeof(int) + 2 * sizeof(uint32_t));
+        for (const Cluster& X : clusters)
+            bytes += X.cells.size() * (sizeof(int) * 3 + sizeof(float) * 3) + (X.dist.size() + X.toUpper.size()) * sizeof(float)
+                + X.out.size() * sizeof(Transition);
+        for (const Region& R : regions) bytes += (R.nodes.size() + R.near.size()) * sizeof(int) + R.dist.size() * sizeof(float);
+        return bytes;
+    }
+
+private:
+    // Ž ۾  (ϲ۸ , ó   )
+    // - Ŭ  (C x C ĭ): cluster ึ  ĭ Ʈ, ĭ  ó    
+    // -   (regionSide x regionSide Ŭ x MAX_NODES Ա, ȣ =   Ŭ ڸ * MAX_NODES + Ա)
+    struct Scratch {
+        int cluster = -1, f = 0, r0 = 0, c0 = 0, w = 0, h = 0;
+        uint32_t rows[C];
+        std::vector<float> cellPos, lg;
+        std::vector<int> lparent;
+        std::vector<uint32_t> posSeen, lseen, lclosed, ltarget;
+        uint32_t posStamp = 0, lstamp = 0, tstamp = 0;
+        std::vector<float> rg;
+        std::vector<int> rparent;
+        std::vector<uint32_t> rseen, rclosed;
+        uint32_t rstamp = 0;
+        std::vector<OpenEntry> heap, sources;
+        std::vector<int> slotCluster; //   ڸ -> Ŭ (regionSearch)
+
+        void allocCells() {
+            if (!lg.empty()) return;
+            size_t cells = (size_t)C * C;
+            cellPos.assign(cells * 3, 0.0f); lg.assign(cells, 0.0f); lparent.assign(cells, -1);
+            posSeen.assign(cells, 0); lseen.assign(cells, 0); lclosed.assign(cells, 0); ltarget.assign(cells, 0);
+        }
+        void allocRegion(int side) {
+            size_t ids = (size_t)side * side * MAX_NODES;
+            if (rg.size() == ids) return;
+            rg.assign(ids, 0.0f); rparent.assign(ids, -1); rseen.assign(ids, 0); rclosed.assign(ids, 0);
+        }
+    };
+    Scratch work; // build  (update / route) 
+    // 2ܰ ( ٸ) / 1ܰ ( ̸) Ž ۾  (Ŭ  x MAX_NODES, ȣ = Ŭ * MAX_NODES + Ա)
+    std::vector<float> ag;
+    std::vector<int> aparent;
+    std::vector<uint32_t> aseen, aclosed;
+    uint32_t astamp = 0;
+    std::vector<OpenEntry> heap;
+    std::vector<float> startCost, goalCost, startUpper, goalUpper;
+    std::vector<int> absPath, chain;
+
+    // 0 ~ count-1 fn(۾ , i) (jobs  BUILD_BATCH ϲ۵鿡)
+    template <typename Fn>
+    void forEachParallel(JobSystem* jobs, int count, Fn fn) {
+        auto batch = [&](int begin, int end) {
+            Scratch s;
+            for (int i = begin; i < end; i++) fn(s, i);
+        };
+        if (jobs) jobs->parallelFor(count, BUILD_BATCH, batch); else batch(0, count);
+    }
+
+    void prepareScratch(Scratch& s, int cl) const {
+        s.allocCells();
+        if (s.cluster == cl) return;
+        s.cluster = cl;
+        int r1, c1;
+        clusterRect(cl, s.f, s.r0, r1, s.c0, c1);
+        s.h = r1 - s.r0; s.w = c1 - s.c0;
+        uint32_t mask = (s.w == 32) ? 0xffffffffu : ((1u << s.w) - 1);
+        for (int lr = 0; lr < s.h; lr++)
+            s.rows[lr] = (uint32_t)(open[((size_t)s.f * n + s.r0 + lr) * wordsPerRow + (s.c0 >> 6)] >> (s.c0 & 63)) & mask;
+        if (++s.posStamp == 0) { std::fill(s.posSeen.begin(), s.posSeen.end(), 0u); s.posStamp = 1; }
+    }
+
+    static bool openAt(const Scratch& s, int l) { return (s.rows[l / C] >> (l % C)) & 1; }
+
+    const float* cellPoint(Scratch& s, int l) const {
+        float* p = &s.cellPos[(size_t)l * 3];
+        if (s.posSeen[l] != s.posStamp) { center(s.f, s.r0 + l / C, s.c0 + l % C, p); s.posSeen[l] = s.posStamp; }
+        return p;
+    }
+
+    // Ŭ cl ȿ from -> to, to  (  INF, ޸ƽ weight )
+    // to < 0̸  ĭ  (lg / lclosed ), targets > 0̸ ltarget == tstamp ĭ ׸ŭ  
+    float localSearch(Scratch& s, int cl, int from, int to, int targets = 0) const {
+        prepareScratch(s, cl);
+        if (++s.lstamp == 0) {
+            std::fill(s.lseen.begin(), s.lseen.end(), 0u); std::fill(s.lclosed.begin(), s.lclosed.end(), 0u);
+            s.lstamp = 1;
+        }
+        const float* tp = (to < 0) ? nullptr : cellPoint(s, to);
+        auto cmp = [](const OpenEntry& a, const OpenEntry& b) { return a.f > b.f; };
+        auto relax = [&](int l, float gv, int parent) {
+            if (s.lseen[l] == s.lstamp && gv >= s.lg[l]) return;
+            s.lseen[l] = s.lstamp; s.lg[l] = gv; s.lparent[l] = parent;
+            s.heap.push_back({ tp ? gv + weight * chord(cellPoint(s, l), tp) : gv, l });
+            std::push_heap(s.heap.begin(), s.heap.end(), cmp);
+        };
+        s.heap.clear();
+        relax(from, 0.0f, -1);
+        while (!s.heap.empty()) {
+            std::pop_heap(s.heap.begin(), s.heap.end(), cmp);
+            int l = s.heap.back().id;
+            s.heap.pop_back();
+            if (s.lclosed[l] == s.lstamp) continue;
+            s.lclosed[l] = s.lstamp;
+            if (l == to) return s.lg[l];
+            if (targets > 0 && s.ltarget[l] == s.tstamp && --targets == 0) break;
+            int lr = l / C, lc = l % C;
+            float gv = s.lg[l];
+            const float* p = cellPoint(s, l);
+            auto step = [&](int next) { if (s.lclosed[next] != s.lstamp) relax(next, gv + chord(p, cellPoint(s, next)), l); };
+            if (lc + 1 < s.w && openAt(s, l + 1)) step(l + 1);
+            if (lc > 0 && openAt(s, l - 1)) step(l - 1);
+            if (lr + 1 < s.h && openAt(s, l + C)) step(l + C);
+            if (lr > 0 && openAt(s, l - C)) step(l - C);
+        }
+        return infinity();
+    }
+
+    // from  ĭ to path ڿ 
+    void appendLocalPath(int cl, int from, int to, std::vector<CubeCell>& path) {
+        if (from == to || localSearch(work, cl, from, to) >= infinity()) return;
+        size_t mark = path.size();
+        for (int l = to; l != from; l = work.lparent[l]) path.push_back(cellAt(cl, l));
+        std::reverse(path.begin() + mark, path.end());
+    }
+
+    //   id (1ܰ ȣ) path ڿ :  Ŭ͸ Ŭ  ĭ , ƴϸ ǳ ĭ ϳ
+    void appendNode(int id, int& prevCluster, int& prevCell, std::vector<CubeCell>& path) {
+        int cl = id / MAX_NODES, cell = clusters[cl].cells[id % MAX_NODES];
+        if (cl == prevCluster) appendLocalPath(cl, prevCell, cell, path);
+        else path.push_back(cellAt(cl, cell));
+        prevCluster = cl; prevCell = cell;
+    }
+
+    // Ŭ cl  ĭ l  Ŭ Ա  (  INF)
+    void entranceCosts(int cl, int l, std::vector<float>& out) {
+        const Cluster& X = clusters[cl];
+        markTargets(work, X, 0);
+        localSearch(work, cl, l, -1, (int)X.cells.size());
+        out.resize(X.cells.size());
+        for (size_t i = 0; i < X.cells.size(); i++) out[i] = (work.lclosed[X.cells[i]] == work.lstamp) ? work.lg[X.cells[i]] : infinity();
+    }
+
+    //  : 1ܰ ׷ A* ( Ŭ͸ Ŭ  ΰ ù ĺ)
+    bool routeClusters(CubeCell s, CubeCell g, std::vector<CubeCell>& path, float& cost, bool refine) {
+        int cs = clusterOf(s), cg = clusterOf(g), ls = localCell(s), lgl = localCell(g);
+        float gp[3];
+        center(g.f, g.r, g.c, gp);
+        float best = (cs == cg) ? localSearch(work, cs, ls, lgl) : infinity();
+        int bestVia = -1;
+
+        nextSearch();
+        auto relax = [&](int id, float gv, int from) {
+            if (aclosed[id] == astamp || (aseen[id] == astamp && gv >= ag[id])) return;
+            aseen[id] = astamp; ag[id] = gv; aparent[id] = from;
+            pushOpen(gv + weight * chord(&clusters[id / MAX_NODES].pos[(size_t)(id % MAX_NODES) * 3], gp), id);
+        };
+        for (size_t i = 0; i < startCost.size(); i++)
+            if (startCost[i] < infinity()) relax(cs * MAX_NODES + (int)i, startCost[i], -1);
+
+        while (!heap.empty()) {
+            OpenEntry e = popOpen();
+            if (e.f >= best) break;
+            if (aclosed[e.id] == astamp) continue;
+            aclosed[e.id] = astamp;
+            expanded++;
+
+            int cl = e.id / MAX_NODES, li = e.id % MAX_NODES;
+            float gv = ag[e.id];
+            if (cl == cg && goalCost[li] < infinity() && gv + goalCost[li] < best) { best = gv + goalCost[li]; bestVia = e.id; }
+            const Cluster& X = clusters[cl];
+            int m = (int)X.cells.size();
+            for (int j = 0; j < m; j++) {
+                float d = X.dist[(size_t)li * m + j];
+                if (j != li && d < infinity()) relax(cl * MAX_NODES + j, gv + d, e.id);
+            }
+            for (int t = X.outStart[li]; t < X.outStart[li + 1]; t++) {
+                const Transition& tr = X.out[t];
+                if (tr.to >= 0) relax(tr.toCluster * MAX_NODES + tr.to, gv + tr.cost, e.id);
+            }
+        }
+        if (best >= infinity()) return false;
+        cost = best;
+        if (!refine) return true;
+
+        // ĭ η ġ:  Ŭ   Ŭ  A*, Ա ǳʱ ̿ ĭ ϳ
+        path.push_back(s);
+        if (bestVia < 0) { appendLocalPath(cs, ls, lgl, path); return true; }
+        absPath.clear();
+        for (int id = bestVia; id >= 0; id = aparent[id]) absPath.push_back(id);
+        int prevCluster = cs, prevCell = ls;
+        for (int i = (int)absPath.size() - 1; i >= 0; i--) appendNode(absPath[i], prevCluster, prevCell, path);
+        appendLocalPath(cg, prevCell, lgl, path);
+        return true;
+    }
+
+    // ٸ :  /  Ŭ Ա ڱ  Ա   2ܰ ׷ A*
+    // ĥ     1ܰ A* ٽ  1ܰ Ա  ٲ  ĭ η
+    bool routeRegions(CubeCell s, CubeCell g, std::vector<CubeCell>& path, float& cost, bool refine) {
+        int cs = clusterOf(s), cg = clusterOf(g), ls = localCell(s), lgl = localCell(g);
+        int rs = regionOf(cs), rgoal = regionOf(cg);
+        float gp[3];
+        center(g.f, g.r, g.c, gp);
+        regionCosts(cs, startCost, startUpper);
+        regionCosts(cg, goalCost, goalUpper);
+
+        float best = infinity();
+        int bestVia = -1;
+        nextSearch();
+        auto relax = [&](int id, float gv, int from) {
+            if (aclosed[id] == astamp || (aseen[id] == astamp && gv >= ag[id])) return;
+            aseen[id] = astamp; ag[id] = gv; aparent[id] = from;
+            pushOpen(gv + weight * chord(&clusters[id / MAX_NODES].pos[(size_t)(id % MAX_NODES) * 3], gp), id);
+        };
+        const Region& RS = regions[rs];
+        for (size_t i = 0; i < RS.nodes.size(); i++)
+            if (startUpper[i] < infinity()) relax(RS.nodes[i], startUpper[i], -1);
+
+        while (!heap.empty()) {
+            OpenEntry e = popOpen();
+            if (e.f >= best) break;
+            if (aclosed[e.id] == astamp) continue;
+            aclosed[e.id] = astamp;
+            expanded++;
+
+            int cl = e.id / MAX_NODES, li = e.id % MAX_NODES;
+            const Cluster& X = clusters[cl];
+            int rx = X.region;
+            const Region& R = regions[rx];
+            int u = X.upper[li], m = (int)R.nodes.size();
+            float gv = ag[e.id];
+            if (rx == rgoal && goalUpper[u] < infinity() && gv + goalUpper[u] < best) { best = gv + goalUpper[u]; bestVia = e.id; }
+            for (int j = 0; j < m; j++) {
+                float d = R.dist[(size_t)u * m + j];
+                if (j != u && d < infinity()) relax(R.nodes[j], gv + d, e.id);
+            }
+            for (int t = X.outStart[li]; t < X.outStart[li + 1]; t++) {
+                const Transition& tr = X.out[t];
+                if (tr.upper && tr.to >= 0 && clusters[tr.toCluster].upper[tr.to] >= 0) relax(tr.toCluster * MAX_NODES + tr.to, gv + tr.cost, e.id);
+            }
+        }
+        if (best >= infinity()) return false;
+        cost = best;
+        if (!refine) return true;
+
+        absPath.clear();
+        for (int id = bestVia; id >= 0; id = aparent[id]) absPath.push_back(id);
+        std::reverse(absPath.begin(), absPath.end());
+        path.push_back(s);
+        int prevCluster = cs, prevCell = ls;
+        //  ĭ -> ù  Ա ( Ŭ Ա ٽ ã)
+        setSources(cs, startCost);
+        regionSearch(work, rs, absPath.front());
+        traceRegion(rs, absPath.front());
+        for (int i = (int)chain.size() - 1; i >= 0; i--) appendNode(chain[i], prevCluster, prevCell, path);
+        for (size_t i = 1; i < absPath.size(); i++) {
+            int a = absPath[i - 1], b = absPath[i], rx = regionOf(b / MAX_NODES);
+            if (regionOf(a / MAX_NODES) != rx) { appendNode(b, prevCluster, prevCell, path); continue; }
+            work.sources.assign(1, { 0.0f, a });
+            regionSearch(work, rx, b);
+            traceRegion(rx, b);
+            for (int j = (int)chain.size() - 2; j >= 0; j--) appendNode(chain[j], prevCluster, prevCell, path);
+        }
+        //   Ա ->  ĭ ( Ŭ Ա ã Ųٷ )
+        setSources(cg, goalCost);
+        regionSearch(work, rgoal, absPath.back());
+        traceRegion(rgoal, absPath.back());
+        for (size_t j = 1; j < chain.size(); j++) appendNode(chain[j], prevCluster, prevCell, path);
+        appendLocalPath(cg, prevCell, lgl, path);
+        return true;
+    }
+
+    void nextSearch() {
+        if (++astamp == 0) {
+            std::fill(aseen.begin(), aseen.end(), 0u); std::fill(aclosed.begin(), aclosed.end(), 0u);
+            astamp = 1;
+        }
+        heap.clear();
+    }
+
+    void pushOpen(float f, int id) {
+        heap.push_back({ f, id });
+        std::push_heap(heap.begin(), heap.end(), [](const OpenEntry& a, const OpenEntry& b) { return a.f > b.f; });
+    }
+
+    OpenEntry popOpen() {
+        std::pop_heap(heap.begin(), heap.end(), [](const OpenEntry& a, const OpenEntry& b) { return a.f > b.f; });
+        OpenEntry e = heap.back();
+        heap.pop_back();
+        return e;
+    }
+
+    int localId(int id) const { return clusters[id / MAX_NODES].slot * MAX_NODES + id % MAX_NODES; }
+    int globalId(int rx, int local) const { return regionCluster(rx, local / MAX_NODES) * MAX_NODES + local % MAX_NODES; }
+
+    // Ŭ cl Ա   Ž 
+    void setSources(int cl, const std::vector<float>& entryCost) {
+        work.sources.clear();
+        for (size_t i = 0; i < entryCost.size(); i++)
+            if (entryCost[i] < infinity()) work.sources.push_back({ entryCost[i], cl * MAX_NODES + (int)i });
+    }
+
+    // Ŭ cl Ա (entryCost) ̾  Ա  (toUpper ǥ   Ա,   INF)
+    void regionCosts(int cl, const std::vector<float>& entryCost, std::vector<float>& out) const {
+        const Cluster& X = clusters[cl];
+        int m = (int)regions[X.region].nodes.size();
+        out.assign(m, infinity());
+        for (size_t i = 0; i < entryCost.size(); i++) {
+            if (entryCost[i] >= infinity()) continue;
+            const float* row = &X.toUpper[i * m];
+            for (int u = 0; u < m; u++) out[u] = std::min(out[u], entryCost[i] + row[u]);
+        }
+    }
+
+    //  rx  1ܰ ׷ s.sources (id,   f)
+    // goal >= 0̸  Ա A* (,   INF, ޸ƽ weight ), ƴϸ  ü (rg / rclosed )
+    float regionSearch(Scratch& s, int rx, int goal) const {
+        s.allocRegion(regionSide);
+        if (++s.rstamp == 0) {
+            std::fill(s.rseen.begin(), s.rseen.end(), 0u); std::fill(s.rclosed.begin(), s.rclosed.end(), 0u);
+            s.rstamp = 1;
+        }
+        s.slotCluster.resize(regionSide * regionSide);
+        for (int slot = 0; slot < regionSide * regionSide; slot++) s.slotCluster[slot] = regionCluster(rx, slot);
+        const float* gp = (goal >= 0) ? &clusters[goal / MAX_NODES].pos[(size_t)(goal % MAX_NODES) * 3] : nullptr;
+        int goalLocal = (goal >= 0) ? localId(goal) : -1;
+        auto cmp = [](const OpenEntry& a, const OpenEntry& b) { return a.f > b.f; };
+        auto relax = [&](int local, const Cluster& X, int li, float gv, int parent) {
+            if (s.rclosed[local] == s.rstamp || (s.rseen[local] == s.rstamp && gv >= s.rg[local])) return;
+            s.rseen[local] = s.rstamp; s.rg[local] = gv; s.rparent[local] = parent;
+            s.heap.push_back({ gp ? gv + weight * chord(&X.pos[(size_t)li * 3], gp) : gv, local });
+            std::push_heap(s.heap.begin(), s.heap.end(), cmp);
+        };
+        s.heap.clear();
+        for (const OpenEntry& e : s.sources) relax(localId(e.id), clusters[e.id / MAX_NODES], e.id % MAX_NODES, e.f, -1);
+        while (!s.heap.empty()) {
+            std::pop_heap(s.heap.begin(), s.heap.end(), cmp);
+            int local = s.heap.back().id;
+            s.heap.pop_back();
+            if (s.rclosed[local] == s.rstamp) continue;
+            s.rclosed[local] = s.rstamp;
+            if (local == goalLocal) return s.rg[local];
+            int base = local - local % MAX_NODES, li = local % MAX_NODES;
+            const Cluster& X = clusters[s.slotCluster[local / MAX_NODES]];
+            int m = (int)X.cells.size();
+            float gv = s.rg[local];
+            for (int j = 0; j < m; j++) {
+                float d = X.dist[(size_t)li * m + j];
+                if (j != li && d < infinity()) relax(base + j, X, j, gv + d, local);
+            }
+            for (int t = X.outStart[li]; t < X.outStart[li + 1]; t++) {
+                const Transition& tr = X.out[t];
+                const Cluster& Y = clusters[tr.toCluster];
+                if (tr.to >= 0 && Y.region == rx) relax(Y.slot * MAX_NODES + tr.to, Y, tr.to, gv + tr.cost, local);
+            }
+        }
+        return infinity();
+    }
+
+    // regionSearch goal ã  goal  Ž chain (1ܰ ȣ)
+    void traceRegion(int rx, int goal) {
+        chain.clear();
+        for (int local = localId(goal); local >= 0; local = work.rparent[local]) chain.push_back(globalId(rx, local));
+    }
+
+    // Ŭ cl    ǳ ĭ ̾  ã Ա 
+    //  ׵θ ĭ ٱ  ĭ ǳʰ  
+    void linkRegions(int rx) {
+        std::vector<int>& near = regions[rx].near;
+        near.clear();
+        int f = rx / (kr * kr), r0 = rx / kr % kr * regionSide * C, c0 = rx % kr * regionSide * C;
+        int r1 = std::min(n, r0 + regionSide * C), c1 = std::min(n, c0 + regionSide * C);
+        const int dr[4] = { -1, 1, 0, 0 };
+        const int dc[4] = { 0, 0, -1, 1 };
+        for (int side = 0; side < 4; side++) {
+            int len = (side < 2) ? c1 - c0 : r1 - r0;
+            for (int i = 0; i < len; i++) {
+                int r = (side == 0) ? r0 : (side == 1) ? r1 - 1 : r0 + i, c = (side == 2) ? c0 : (side == 3) ? c1 - 1 : c0 + i;
+                int other = regionOf(clusterOf(cubeSeamCell(f, r + dr[side], c + dc[side], n)));
+                if (other != rx && std::find(near.begin(), near.end(), other) == near.end()) near.push_back(other);
+            }
+        }
+    }
+
+    void buildEntrances(int cl) {
+        Cluster& X = clusters[cl];
+        X.cells.clear(); X.pos.clear(); X.out.clear();
+        int f, r0, r1, c0, c1;
+        clusterRect(cl, f, r0, r1, c0, c1);
+        struct Edge { CubeCell a, b; };
+        std::vector<Edge> run;
+        std::vector<int> fromCell;
+        auto addEdge = [&](const Edge& e) {
+            int la = localCell(e.a);
+            float pa[3], pb[3];
+            center(e.a.f, e.a.r, e.a.c, pa);
+            center(e.b.f, e.b.r, e.b.c, pb);
+            X.out.push_back({ -1, clusterOf(e.b), localCell(e.b), -1, chord(pa, pb), false });
+            fromCell.push_back(la);
+        };
+        //  ϳ  Ա (ǳ Ŭ͵   ݴ  Ƿ   )
+        auto closeRun = [&]() {
+            int len = (int)run.size();
+            if (len == 0) return;
+            if (len >= LONG_RUN) { addEdge(run[0]); addEdge(run[len - 1]); }
+            else if (len % 2 == 1) addEdge(run[len / 2]);
+            else {
+                const Edge& p = run[len / 2 - 1];
+                const Edge& q = run[len / 2];
+                long long kp = std::min(cellKey(p.a), cellKey(p.b)), kq = std::min(cellKey(q.a), cellKey(q.b));
+                addEdge(kp < kq ? p : q);
+            }
+            run.clear();
+        };
+        const int dr[4] = { -1, 1, 0, 0 };
+        const int dc[4] = { 0, 0, -1, 1 };
+        for (int side = 0; side < 4; side++) {
+            int len = (side < 2) ? c1 - c0 : r1 - r0;
+            int runCluster = -1;
+            for (int i = 0; i < len; i++) {
+                CubeCell a = { f, (side == 0) ? r0 : (side == 1) ? r1 - 1 : r0 + i, (side == 2) ? c0 : (side == 3) ? c1 - 1 : c0 + i };
+                CubeCell b = cubeSeamCell(f, a.r + dr[side], a.c + dc[side], n);
+                int bc = clusterOf(b);
+                if (!isOpen(a) || !isOpen(b) || bc != runCluster) { closeRun(); runCluster = bc; }
+                if (isOpen(a) && isOpen(b)) run.push_back({ a, b });
+            }
+            closeRun();
+        }
+
+        // Ա =   ĭ (ġ ϳ),  Ա 
+        std::vector<Transition> edges = X.out;
+        for (size_t e = 0; e < edges.size(); e++) {
+            int idx = (int)(std::find(X.cells.begin(), X.cells.end(), fromCell[e]) - X.cells.begin());
+            if (idx == (int)X.cells.size()) {
+                X.cells.push_back(fromCell[e]);
+                CubeCell p = cellAt(cl, fromCell[e]);
+                X.pos.resize(X.pos.size() + 3);
+                center(p.f, p.r, p.c, &X.pos[X.pos.size() - 3]);
+            }
+            edges[e].from = idx;
+        }
+        std::stable_sort(edges.begin(), edges.end(), [](const Transition& a, const Transition& b) { return a.from < b.from; });
+        X.out = edges;
+        X.outStart.assign(X.cells.size() + 1, 0);
+        for (const Transition& t : X.out) X.outStart[t.from + 1]++;
+        for (size_t i = 0; i < X.cells.size(); i++) X.outStart[i + 1] += X.outStart[i];
+    }
+
+    // ǳ ĭ  Ŭ Ա ȣ
+    void resolveTransitions(int cl) {
+        for (Transition& t : clusters[cl].out) {
+            const std::vector<int>& cells = clusters[t.toCluster].cells;
+            int idx = (int)(std::find(cells.begin(), cells.end(), t.toCell) - cells.begin());
+            t.to = (idx < (int)cells.size()) ? idx : -1;
+        }
+    }
+
+    // Ա i ȣ  ū Ա ã (  ) ǥ ʿ 
+    void buildDistances(Scratch& s, int cl) {
+        Cluster& X = clusters[cl];
+        int m = (int)X.cells.size();
+        X.dist.assign((size_t)m * m, infinity());
+        for (int i = 0; i < m; i++) {
+            X.dist[(size_t)i * m + i] = 0.0f;
+            if (i + 1 == m) break;
+            markTargets(s, X, i + 1);
+            localSearch(s, cl, X.cells[i], -1, m - 1 - i);
+            for (int j = i + 1; j < m; j++)
+                if (s.lclosed[X.cells[j]] == s.lstamp) X.dist[(size_t)i * m + j] = X.dist[(size_t)j * m + i] = s.lg[X.cells[j]];
+        }
+    }
+
+    // Ա i Ŭ ȿ ̾ Ա    ȣ (̾  ̸)
+    static int part(const Cluster& X, int i) {
+        int m = (int)X.cells.size();
+        for (int j = 0; j < i; j++)
+            if (X.dist[(size_t)i * m + j] < infinity()) return j;
+        return i;
+    }
+
+    //  rx  1ܰ ׷ (Ŭ  ǥ +   ) ̾  regionPart
+    void buildParts(int rx) {
+        std::vector<int> root(regionSide * regionSide * MAX_NODES);
+        for (int i = 0; i < (int)root.size(); i++) root[i] = i;
+        auto find = [&](int a) {
+            while (root[a] != a) a = root[a] = root[root[a]];
+            return a;
+        };
+        auto unite = [&](int a, int b) { //  ȣ Ѹ ( ̸   ̸)
+            a = find(a); b = find(b);
+            if (a < b) root[b] = a; else root[a] = b;
+        };
+        for (int slot = 0; slot < regionSide * regionSide; slot++) {
+            int cl = regionCluster(rx, slot);
+            if (cl < 0) continue;
+            const Cluster& X = clusters[cl];
+            for (int i = 0; i < (int)X.cells.size(); i++) {
+                unite(slot * MAX_NODES + i, slot * MAX_NODES + part(X, i));
+                for (int t = X.outStart[i]; t < X.outStart[i + 1]; t++) {
+                    const Transition& tr = X.out[t];
+                    const Cluster& Y = clusters[tr.toCluster];
+                    if (tr.to >= 0 && Y.region == rx) unite(slot * MAX_NODES + i, Y.slot * MAX_NODES + tr.to);
+                }
+            }
+        }
+        for (int slot = 0; slot < regionSide * regionSide; slot++) {
+            int cl = regionCluster(rx, slot);
+            if (cl < 0) continue;
+            Cluster& X = clusters[cl];
+            X.regionPart.resize(X.cells.size());
+            for (int i = 0; i < (int)X.cells.size(); i++) X.regionPart[i] = find(slot * MAX_NODES + i);
+        }
+    }
+
+    //  rx ٸ  ǳʰ  (ǳ ,  ,  )   REGION_DOORS 2ܰ迡 ø
+    // ĭ  ȣ    ڸ (ǳ      Ƿ   )
+    //       ȿ  ̾ Ƿ   ܵ    ״
+    //   ٲ true
+    bool selectUpper(int rx) {
+        struct Candidate { int region, fromPart, toPart; long long keyLow, keyHigh; Transition* t; };
+        std::vector<Candidate> list;
+        bool changed = false;
+        for (int slot = 0; slot < regionSide * regionSide; slot++) {
+            int cl = regionCluster(rx, slot);
+            if (cl < 0) continue;
+            Cluster& X = clusters[cl];
+            for (Transition& t : X.out) {
+                const Cluster& Y = clusters[t.toCluster];
+                if (t.to < 0 || Y.region == rx) { changed = changed || t.upper; t.upper = false; continue; }
+                long long a = cellKey(cellAt(cl, X.cells[t.from])), b = cellKey(cellAt(t.toCluster, t.toCell));
+                list.push_back({ Y.region, X.regionPart[t.from], Y.regionPart[t.to], std::min(a, b), std::max(a, b), &t });
+            }
+        }
+        std::sort(list.begin(), list.end(), [](const Candidate& a, const Candidate& b) {
+            if (a.region != b.region) return a.region < b.region;
+            if (a.fromPart != b.fromPart) return a.fromPart < b.fromPart;
+            if (a.toPart != b.toPart) return a.toPart < b.toPart;
+            return a.keyLow != b.keyLow ? a.keyLow < b.keyLow : a.keyHigh < b.keyHigh;
+        });
+        for (size_t begin = 0, end; begin < list.size(); begin = end) {
+            end = begin;
+            while (end < list.size() && list[end].region == list[begin].region && list[end].fromPart == list[begin].fromPart
+                && list[end].toPart == list[begin].toPart) end++;
+            int count = (int)(end - begin), next = 0;
+            for (int i = 0; i < count; i++) {
+                // d°  =  (2d + 1) / (2 * REGION_DOORS) ڸ
+                bool pick = next < REGION_DOORS && 2 * REGION_DOORS * (i + 1) > (2 * next + 1) * count;
+                if (pick) next++;
+                Transition& t = *list[begin + i].t;
+                changed = changed || t.upper != pick;
+                t.upper = pick;
+            }
+        }
+        return changed;
+    }
+
+    //  Ա  (Ŭ ڸ , Ա )  Ա  ü ã
+    //   Ŭ Ա   Ա  (toUpper)  Ա ǥ 
+    void buildRegion(Scratch& s, int rx) {
+        Region& R = regions[rx];
+        R.nodes.clear();
+        for (int slot = 0; slot < regionSide * regionSide; slot++) {
+            int cl = regionCluster(rx, slot);
+            if (cl < 0) continue;
+            Cluster& X = clusters[cl];
+            X.upper.assign(X.cells.size(), -1);
+            for (const Transition& t : X.out)
+                if (t.upper && X.upper[t.from] < 0) { X.upper[t.from] = (int)R.nodes.size(); R.nodes.push_back(cl * MAX_NODES + t.from); }
+        }
+        int m = (int)R.nodes.size();
+        for (int slot = 0; slot < regionSide * regionSide; slot++) {
+            int cl = regionCluster(rx, slot);
+            if (cl >= 0) clusters[cl].toUpper.assign(clusters[cl].cells.size() * m, infinity());
+        }
+        for (int u = 0; u < m; u++) {
+            s.sources.assign(1, { 0.0f, R.nodes[u] });
+            regionSearch(s, rx, -1);
+            for (int slot = 0; slot < regionSide * regionSide; slot++) {
+                int cl = regionCluster(rx, slot);
+                if (cl < 0) continue;
+                Cluster& X = clusters[cl];
+                for (size_t li = 0; li < X.cells.size(); li++)
+                    if (s.rclosed[slot * MAX_NODES + li] == s.rstamp) X.toUpper[li * m + u] = s.rg[slot * MAX_NODES + li];
+            }
+        }
+        R.dist.resize((size_t)m * m);
+        for (int v = 0; v < m; v++) {
+            const Cluster& X = clusters[R.nodes[v] / MAX_NODES];
+            for (int u = 0; u < m; u++) R.dist[(size_t)u * m + v] = X.toUpper[(size_t)(R.nodes[v] % MAX_NODES) * m + u];
+        }
+    }
+
+    static void markTargets(Scratch& s, const Cluster& X, int first) {
+        s.allocCells();
+        if (++s.tstamp == 0) { std::fill(s.ltarget.begin(), s.ltarget.end(), 0u); s.tstamp = 1; }
+        for (size_t j = first; j < X.cells.size(); j++) s.ltarget[X.cells[j]] = s.tstamp;
+    }
+};
@@ -0,0 +1,78 @@
+#pragma once
+// ----------------------------------------------------------
+// [  ]  ȣ  ĭ (, , )  
+//  ִ ĭ Ŷ  (ū ༺ 6N^2¥ 迭 ʿ )
+// Ŷ  ȣ  迭(slots) ̾ ٿ ΰ,   Ŷ ʿ  
+// - build : ĭ Ű  ؼ Ŷ 
+// - at    : ĭ ϳ   ( + )
+// - remove: ֿ  Ŷ   ۰ ڸ ٲٰ   (O(1))
+//    EntityStore  Ƿ ⼭ ĭ  
+// ----------------------------------------------------------
+#include <vector>
+#include <unordered_map>
+#include <algorithm>
+#include <cstddef>
+#include "CubeTopology.h"
+
+struct ItemIndex {
+    int n = 0;
+    std::unordered_map<long long, int> bucketOf; // ĭ Ű -> Ŷ ȣ
+    std::vector<int> bucketStart, bucketCount;   // Ŷ slots  ڸ /   
+    std::vector<int> slots;                      // Ŷ  ̾   ȣ
+    std::vector<int> slotOf, itemBucket;         //  ȣ -> slots ڸ / Ŷ ȣ
+
+    static long long key(int n, int f, int r, int c) { return ((long long)f * n + r) * n + c; }
+
+    // cells[i] =  i  ĭ
+    void build(int size, const std::vector<CubeCell>& cells) {
+        n = size;
+        int count = (int)cells.size();
+        std::vector<int> order(count);
+        for (int i = 0; i < count; i++) order[i] = i;
+        std::sort(order.begin(), order.end(), [&](int a, int b) {
+            return key(n, cells[a].f, cells[a].r, cells[a].c) < key(n, cells[b].f, cells[b].r, cells[b].c);
+        });
+
+        bucketOf.clear();
+        bucketStart.clear(); bucketCount.clear();
+        slots.assign(order.begin(), order.end());
+        slotOf.assign(count, 0); itemBucket.assign(count, 0);
+        for (int s = 0; s < count; s++) {
+            int i = order[s];
+            long long k = key(n, cells[i].f, cells[i].r, cells[i].c);
+            if (s == 0 || k != key(n, cells[order[s - 1]].f, cells[order[s - 1]].r, cells[order[s - 1]].c)) {
+                bucketOf[k] = (int)bucketStart.size();
+                bucketStart.push_back(s);
+                bucketCount.push_back(0);
+            }
+            int b = (int)bucketStart.size() - 1;
+            bucketCount[b]++;
+            slotOf[i] = s; itemBucket[i] = b;
+        }
+    }
+
+    // ĭ (f, r, c)   ȣ,  count = 0
+    const int* at(int f, int r, int c, int& count) const {
+        auto it = bucketOf.find(key(n, f, r, c));
+        if (it == bucketOf.end()) { count = 0; return nullptr; }
+        count = bucketCount[it->second];
+        return &slots[bucketStart[it->second]];
+    }
+
+    // Ŷ   ȿ    ֿ 
+    bool isActive(int i) const { return slotOf[i] < bucketStart[itemBucket[i]] + bucketCount[itemBucket[i]]; }
+
+    void remove(int i) {
+        if (!isActive(i)) return;
+        int b = itemBucket[i];
+        int last = bucketStart[b] + --bucketCount[b];
+        int moved = slots[last];
+        std::swap(slots[slotOf[i]], slots[last]);
+        slotOf[moved] = slotOf[i]; slotOf[i] = last;
+    }
+
+    size_t memoryBytes() const {
+        return bucketOf.size() * (sizeof(long long) + sizeof(int) + 2 * sizeof(void*))
+            + (bucketStart.size() + bucketCount.size() + slots.size() + slotOf.size() + itemBucket.size()) * sizeof(int);
+    }
+};
\ No newline at end of file
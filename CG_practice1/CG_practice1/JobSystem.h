@@ -0,0 +1,96 @@
+#pragma once
+// ----------------------------------------------------------
+// [۾ ] ϲ 带 ̸  ΰ, 0 ~ count-1  batch ߶  ñ
+// - parallelFor: fn(begin, end)  ȣ, θ 嵵  ϰ   ƿ
+// -   īͷ   尡  (  尡   )
+//   ͸  ʾƾ  ( )
+// ϲ  0̸ θ  ȥ ʷ 
+// ----------------------------------------------------------
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <functional>
+
+struct JobSystem {
+    std::vector<std::thread> workers;
+    std::mutex lock;
+    std::condition_variable wake, finished;
+    std::function<void(int, int)> job;
+    int jobCount = 0, jobBatch = 1;
+    std::atomic<int> nextBegin{ 0 };
+    int busy = 0;            //  ̹  ϰ ִ ϲ 
+    unsigned generation = 0; // parallelFor θ  ϳ (ϲ   )
+    bool quit = false;
+
+    JobSystem() {}
+    JobSystem(const JobSystem&) = delete;
+    JobSystem& operator=(const JobSystem&) = delete;
+    ~JobSystem() { stop(); }
+
+    // ϲ threads (θ  threads + 1 )
+    void start(int threads) {
+        stop();
+        quit = false;
+        for (int i = 0; i < threads; i++) workers.emplace_back([this]() { workerLoop(); });
+    }
+
+    void stop() {
+        {
+            std::lock_guard<std::mutex> g(lock);
+            quit = true;
+        }
+        wake.notify_all();
+        for (auto& t : workers) t.join();
+        workers.clear();
+    }
+
+    int threadCount() const { return (int)workers.size() + 1; }
+
+    template <typename Fn>
+    void parallelFor(int count, int batch, Fn fn) {
+        if (count <= 0) return;
+        if (workers.empty() || count <= batch) { fn(0, count); return; }
+        {
+            std::lock_guard<std::mutex> g(lock);
+            job = fn;
+            jobCount = count; jobBatch = batch;
+            nextBegin = 0;
+            busy = (int)workers.size();
+            generation++;
+        }
+        wake.notify_all();
+        runBatches();
+        std::unique_lock<std::mutex> g(lock);
+        finished.wait(g, [this]() { return busy == 0; });
+        job = nullptr;
+    }
+
+private:
+    void runBatches() {
+        for (;;) {
+            int begin = nextBegin.fetch_add(jobBatch);
+            if (begin >= jobCount) return;
+            int end = (begin + jobBatch < jobCount) ? begin + jobBatch : jobCount;
+            job(begin, end);
+        }
+    }
+
+    void workerLoop() {
+        unsigned seen = 0;
+        for (;;) {
+            {
+                std::unique_lock<std::mutex> g(lock);
+                wake.wait(g, [&]() { return quit || generation != seen; });
+                if (quit) return;
+                seen = generation;
+            }
+            runBatches();
+            {
+                std::lock_guard<std::mutex> g(lock);
+                if (--busy == 0) finished.notify_one();
+            }
+        }
+    }
+};
\ No newline at end of file
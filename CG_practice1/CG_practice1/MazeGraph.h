@@ -0,0 +1,215 @@
+#pragma once
+// ----------------------------------------------------------
+// [̷ ׷]  ƴ ĭ , ¿ ̾ ĭ      (CSR ġ)
+//   ʸ ̿ getNeighborValue ׵θ    ǥ (cubeSeamCell) 
+// -  ȣ = //    ĭ  -> ĭ ȣ ǥ  ʰ
+//    ĭ Ʈ + 帶 ձ  ĭ  (rank)  (ĭ 1.5Ʈ)
+// - edgeStart[v] ~ edgeStart[v + 1] - 1   v ,   ĭ    (,  )
+// - component: ̾  ȣ ->    ǥ ãƺ ʰ ٷ  ( ׷  ü  )
+// [ ã] PathFinder: ޸ƽ = ǥ   (  պ ۰ų Ƿ ִ )
+// Ǹ 迭  ʰ  ȣ(stamp) ̹ ǿ ǵ帰   ->   Ҵ 
+// ----------------------------------------------------------
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include <cmath>
+#include <algorithm>
+#include "CubeTopology.h"
+
+//  Ʈ  (CPU  )
+inline int bitCount64(uint64_t x) {
+    x = x - ((x >> 1) & 0x5555555555555555ull);
+    x = (x & 0x3333333333333333ull) + ((x >> 2) & 0x3333333333333333ull);
+    x = (x + (x >> 4)) & 0x0F0F0F0F0F0F0F0Full;
+    return (int)((x * 0x0101010101010101ull) >> 56);
+}
+
+struct MazeGraph {
+    int n = 0;
+    int wordsPerRow = 0;
+    std::vector<uint64_t> open;     // [][][]  ĭ Ʈ (WallBits  ġ)
+    std::vector<uint32_t> rankBase; // 帶  ձ  ĭ 
+    std::vector<int> cellKey;       //  -> ( * n + ) * n + 
+    std::vector<float> pos;         //  -> ĭ    (3)
+    std::vector<int> edgeStart;     //   + 1
+    std::vector<int> edgeTo;
+    std::vector<float> edgeCost;
+    std::vector<int> component;     //  -> ̾  ȣ
+    int componentCount = 0;
+
+    int nodeCount() const { return (int)cellKey.size(); }
+    int edgeCount() const { return (int)edgeTo.size(); }
+
+    // ĭ  ȣ, ̸ -1
+    int node(int f, int r, int c) const {
+        size_t i = ((size_t)f * n + r) * wordsPerRow + (c >> 6);
+        int b = c & 63;
+        if (!((open[i] >> b) & 1)) return -1;
+        return (int)rankBase[i] + bitCount64(open[i] & (((uint64_t)1 << b) - 1));
+    }
+
+    void cellOf(int v, int& f, int& r, int& c) const {
+        int k = cellKey[v];
+        c = k % n; k /= n;
+        r = k % n; f = k / n;
+    }
+
+    //      (  Ȯϵ acos  atan2)
+    static float arc(const float* a, const float* b) {
+        float cx = a[1] * b[2] - a[2] * b[1], cy = a[2] * b[0] - a[0] * b[2], cz = a[0] * b[1] - a[1] * b[0];
+        return atan2f(sqrtf(cx * cx + cy * cy + cz * cz), a[0] * b[0] + a[1] * b[1] + a[2] * b[2]);
+    }
+    float arc(int a, int b) const { return arc(&pos[(size_t)a * 3], &pos[(size_t)b * 3]); }
+
+    // isWall(f, r, c):   ĭ , center(f, r, c): ĭ  (.x .y .z, ̴ )
+    template <typename IsWall, typename Center>
+    void build(int size, IsWall isWall, Center center) {
+        n = size;
+        wordsPerRow = (size + 63) >> 6;
+        open.assign((size_t)6 * n * wordsPerRow, 0);
+        rankBase.assign(open.size(), 0);
+        for (int f = 0; f < 6; f++)
+            for (int r = 0; r < n; r++)
+                for (int c = 0; c < n; c++)
+                    if (!isWall(f, r, c)) open[((size_t)f * n + r) * wordsPerRow + (c >> 6)] |= (uint64_t)1 << (c & 63);
+        uint32_t count = 0;
+        for (size_t i = 0; i < open.size(); i++) { rankBase[i] = count; count += bitCount64(open[i]); }
+
+        cellKey.resize(count);
+        pos.resize((size_t)count * 3);
+        int v = 0;
+        for (int f = 0; f < 6; f++)
+            for (int r = 0; r < n; r++)
+                for (int c = 0; c < n; c++) {
+                    if (node(f, r, c) < 0) continue;
+                    cellKey[v] = (f * n + r) * n + c;
+                    auto p = center(f, r, c);
+                    float len = sqrtf(p.x * p.x + p.y * p.y + p.z * p.z);
+                    pos[(size_t)v * 3] = p.x / len; pos[(size_t)v * 3 + 1] = p.y / len; pos[(size_t)v * 3 + 2] = p.z / len;
+                    v++;
+                }
+
+        const int dr[4] = { -1, 1, 0, 0 };
+        const int dc[4] = { 0, 0, -1, 1 };
+        edgeStart.assign(count + 1, 0);
+        edgeTo.clear(); edgeCost.clear();
+        edgeTo.reserve((size_t)count * 3); edgeCost.reserve((size_t)count * 3);
+        for (v = 0; v < (int)count; v++) {
+            edgeStart[v] = (int)edgeTo.size();
+            int f, r, c;
+            cellOf(v, f, r, c);
+            for (int k = 0; k < 4; k++) {
+                CubeCell t = cubeSeamCell(f, r + dr[k], c + dc[k], n);
+                int u = node(t.f, t.r, t.c);
+                if (u < 0) continue;
+                edgeTo.push_back(u);
+                edgeCost.push_back(arc(v, u));
+            }
+        }
+        edgeStart[count] = (int)edgeTo.size();
+
+        // ̾ :  ȣ  忡 ʺ 켱  (component ťε )
+        component.assign(count, -1);
+        std::vector<int> queue;
+        queue.reserve(count);
+        componentCount = 0;
+        for (v = 0; v < (int)count; v++) {
+            if (component[v] >= 0) continue;
+            queue.clear();
+            queue.push_back(v);
+            component[v] = componentCount;
+            for (size_t head = 0; head < queue.size(); head++) {
+                int x = queue[head];
+                for (int e = edgeStart[x]; e < edgeStart[x + 1]; e++) {
+                    if (component[edgeTo[e]] >= 0) continue;
+                    component[edgeTo[e]] = componentCount;
+                    queue.push_back(edgeTo[e]);
+                }
+            }
+            componentCount++;
+        }
+    }
+
+    bool connected(int a, int b) const { return a >= 0 && b >= 0 && component[a] == component[b]; }
+
+    size_t memoryBytes() const {
+        return open.size() * sizeof(uint64_t) + rankBase.size() * sizeof(uint32_t) + cellKey.size() * sizeof(int)
+            + pos.size() * sizeof(float) + edgeStart.size() * sizeof(int) + edgeTo.size() * sizeof(int) + edgeCost.size() * sizeof(float)
+            + component.size() * sizeof(int);
+    }
+};
+
+struct PathFinder {
+    struct OpenEntry { float f; int node; };
+
+    std::vector<float> g;           // ߿   (seen[v] == stamp  ȿ)
+    std::vector<int> parent;
+    std::vector<uint32_t> seen, closed;
+    std::vector<OpenEntry> openList; // ּ  ( 尡     ,     )
+    uint32_t stamp = 0;
+    int expanded = 0;                //  ǿ   
+
+    // ׷ ٲ  ũ⸦  ( ߿ Ҵ )
+    void prepare(const MazeGraph& graph) {
+        int count = graph.nodeCount();
+        if ((int)g.size() == count) return;
+        g.assign(count, 0.0f); parent.assign(count, -1);
+        seen.assign(count, 0); closed.assign(count, 0);
+        stamp = 0;
+    }
+
+    // start isGoal(v)   , h(v)    (0̸ ͽƮ)
+    // ã ǥ  ( -1), path =  ~ ǥ  , cost =  
+    template <typename IsGoal, typename Heuristic>
+    int search(const MazeGraph& graph, int start, IsGoal isGoal, Heuristic h, std::vector<int>& path, float& cost) {
+        prepare(graph);
+        path.clear(); cost = 0.0f; expanded = 0;
+        if (start < 0) return -1;
+        if (++stamp == 0) { //  ȣ      
+            std::fill(seen.begin(), seen.end(), 0u); std::fill(closed.begin(), closed.end(), 0u);
+            stamp = 1;
+        }
+        auto cmp = [](const OpenEntry& a, const OpenEntry& b) { return a.f > b.f; };
+        openList.clear();
+        g[start] = 0.0f; parent[start] = -1; seen[start] = stamp;
+        openList.push_back({ h(start), start });
+
+        while (!openList.empty()) {
+            std::pop_heap(openList.begin(), openList.end(), cmp);
+            int v = openList.back().node;
+            openList.pop_back();
+            if (closed[v] == stamp) continue;
+            closed[v] = stamp;
+            expanded++;
+
+            if (isGoal(v)) {
+                cost = g[v];
+                for (int u = v; u >= 0; u = parent[u]) path.push_back(u);
+                std::reverse(path.begin(), path.end());
+                return v;
+            }
+            for (int e = graph.edgeStart[v]; e < graph.edgeStart[v + 1]; e++) {
+                int u = graph.edgeTo[e];
+                if (closed[u] == stamp) continue;
+                float gu = g[v] + graph.edgeCost[e];
+                if (seen[u] == stamp && gu >= g[u]) continue;
+                seen[u] = stamp; g[u] = gu; parent[u] = v;
+                openList.push_back({ gu + h(u), u });
+                std::push_heap(openList.begin(), openList.end(), cmp);
+            }
+        }
+        return -1;
+    }
+
+    //  ϳ ǥ (޸ƽ =  ), ٸ ̸ ã 
+    int route(const MazeGraph& graph, int start, int goal, std::vector<int>& path, float& cost) {
+        if (!graph.connected(start, goal)) { path.clear(); cost = 0.0f; expanded = 0; return -1; }
+        const float* gp = &graph.pos[(size_t)goal * 3];
+        return search(graph, start, [goal](int v) { return v == goal; },
+            [&](int v) { return MazeGraph::arc(&graph.pos[(size_t)v * 3], gp); }, path, cost);
+    }
+
+    size_t memoryBytes() const {
+        return g.size() * (sizeof(float) + sizeof(int) + 2 * sizeof(uint32_t)) + openList.capacity() * sizeof(OpenEntry);
+    }
+};
\ No newline at end of file
@@ -0,0 +1,93 @@
+#pragma once
+// ----------------------------------------------------------
+// [  ] .dat  ҷ      δ 
+//   +     +  (crease) ݿ 𼭸 
+// P x, y, z   ü(Point3D), F v1, v2, v3   ü(Face)
+// ----------------------------------------------------------
+#include <vector>
+#include <map>
+#include <tuple>
+#include <cmath>
+
+template <typename P>
+inline P mnCross(const P& a, const P& b, const P& c) {
+    P u = { b.x - a.x, b.y - a.y, b.z - a.z };
+    P v = { c.x - a.x, c.y - a.y, c.z - a.z };
+    P n = { u.y * v.z - u.z * v.y, u.z * v.x - u.x * v.z, u.x * v.y - u.y * v.x };
+    return n; //  = ﰢ  2 (ȭ  ä ġ )
+}
+
+template <typename P>
+inline P mnNormalize(P n) {
+    float len = sqrt(n.x * n.x + n.y * n.y + n.z * n.z);
+    if (len > 0) { n.x /= len; n.y /= len; n.z /= len; }
+    return n;
+}
+
+// faceNormals   : 鸶 1
+// vertexNormals :  1 ( ġ  ϳ  ֺ  ̷  )
+// cornerNormals : 鸶 3 ( i k°  = [i * 3 + k])
+//                 ̿   creaseDeg ũ   տ  𼭸  
+//                 creaseDeg >= 180̸ vertexNormals , 0̸ ó   ״
+template <typename P, typename F>
+void buildModelNormals(const std::vector<P>& vertices, const std::vector<F>& faces, float creaseDeg,
+    std::vector<P>& faceNormals, std::vector<P>& vertexNormals, std::vector<P>& cornerNormals) {
+    int numV = (int)vertices.size(), numF = (int)faces.size();
+    P zero = { 0, 0, 0 };
+
+    // 1.  ǥ    (SOR     )
+    std::vector<int> group(numV);
+    std::map<std::tuple<float, float, float>, int> posToGroup;
+    for (int v = 0; v < numV; v++) {
+        auto key = std::make_tuple(vertices[v].x, vertices[v].y, vertices[v].z);
+        auto it = posToGroup.find(key);
+        if (it == posToGroup.end()) { int g = (int)posToGroup.size(); posToGroup[key] = g; group[v] = g; }
+        else group[v] = it->second;
+    }
+    int numG = (int)posToGroup.size();
+
+    // 2.   +    
+    std::vector<P> areaNormals(numF, zero); // ȭ  
+    std::vector<P> groupSum(numG, zero);
+    std::vector<std::vector<int>> groupFaces(numG);
+    faceNormals.assign(numF, zero);
+    for (int i = 0; i < numF; i++) {
+        const F& f = faces[i];
+        int idx[3] = { f.v1, f.v2, f.v3 };
+        if (idx[0] < 0 || idx[0] >= numV || idx[1] < 0 || idx[1] >= numV || idx[2] < 0 || idx[2] >= numV) continue;
+        P n = mnCross(vertices[idx[0]], vertices[idx[1]], vertices[idx[2]]);
+        areaNormals[i] = n;
+        faceNormals[i] = mnNormalize(n);
+        for (int k = 0; k < 3; k++) {
+            P& s = groupSum[group[idx[k]]];
+            s.x += n.x; s.y += n.y; s.z += n.z;
+            std::vector<int>& gf = groupFaces[group[idx[k]]];
+            if (gf.empty() || gf.back() != i) gf.push_back(i);
+        }
+    }
+
+    vertexNormals.resize(numV);
+    for (int v = 0; v < numV; v++) vertexNormals[v] = mnNormalize(groupSum[group[v]]);
+
+    // 3. 𼭸  (  )
+    cornerNormals.assign(numF * 3, zero);
+    float cosCrease = cos(creaseDeg * 3.14159265f / 180.0f);
+    for (int i = 0; i < numF; i++) {
+        const F& f = faces[i];
+        int idx[3] = { f.v1, f.v2, f.v3 };
+        if (idx[0] < 0 || idx[0] >= numV || idx[1] < 0 || idx[1] >= numV || idx[2] < 0 || idx[2] >= numV) continue;
+        const P& fn = faceNormals[i];
+        for (int k = 0; k < 3; k++) {
+            if (creaseDeg >= 180.0f) { cornerNormals[i * 3 + k] = vertexNormals[idx[k]]; continue; }
+
+            P s = areaNormals[i];
+            for (int j : groupFaces[group[idx[k]]]) {
+                if (j == i) continue;
+                const P& gn = faceNormals[j];
+                if (fn.x * gn.x + fn.y * gn.y + fn.z * gn.z < cosCrease) continue; // ʹ  ̿ 
+                s.x += areaNormals[j].x; s.y += areaNormals[j].y; s.z += areaNormals[j].z;
+            }
+            cornerNormals[i * 3 + k] = mnNormalize(s);
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,225 @@
+#pragma once
+// ----------------------------------------------------------
+// [༺ ] 6 x N x N   ߿ ũ⸦ ؼ 
+// ĭ 64x64 Ÿ  ٿ  (Ÿ ϳ = 4KB)
+//  پ ϸ N Ŭ  /Ʒ ĭ NƮ , Ÿ ȿ 64Ʈ 
+// 鸶 ٱ ׵θ(halo)  ĭ  ΰ ̿    
+// -> / -1  N at() ٷ   ־ ̿ ȸ   бⰡ ʿ 
+// ----------------------------------------------------------
+#include <vector>
+#include <string>
+#include <fstream>
+#include <cstdint>
+#include <cstddef>
+#include <cstdlib>
+#include "CubeTopology.h"
+
+// [CSV  ]  °   (rows x cols)
+//   о 6   ū ũ N   
+struct GridCSV {
+    int rows = 0, cols = 0;
+    std::vector<uint8_t> cells; // rows x cols, Ͽ   ״
+    std::vector<int> rowLength; // ٸ  ĭ  (  0,   ĭ ʿ  )
+
+    bool read(const char* filename) {
+        std::ifstream file(filename);
+        if (!file.is_open()) return false;
+
+        std::vector<std::vector<uint8_t>> lines;
+        std::string line;
+        while (std::getline(file, line)) {
+            std::vector<uint8_t> row;
+            const char* p = line.c_str();
+            while (*p && *p != '\r') {
+                char* end;
+                long val = strtol(p, &end, 10);
+                if (end == p) val = 0; //  ĭ / ڰ ƴ ĭ
+                row.push_back((uint8_t)val);
+                p = end;
+                while (*p && *p != ',' && *p != '\r') p++;
+                if (*p == ',') p++;
+            }
+            lines.push_back(row); //  ٵ  ٷ  ( δó   ĭ 0 )
+        }
+        while (!lines.empty() && lines.back().empty()) lines.pop_back(); //     ũ⿡  
+
+        rows = (int)lines.size();
+        cols = 0;
+        rowLength.assign(rows, 0);
+        for (int r = 0; r < rows; r++) {
+            rowLength[r] = (int)lines[r].size();
+            if (rowLength[r] > cols) cols = rowLength[r];
+        }
+        cells.assign((size_t)rows * cols, 0);
+        for (int r = 0; r < rows; r++)
+            for (int c = 0; c < rowLength[r]; c++) cells[(size_t)r * cols + c] = lines[r][c];
+        return true;
+    }
+};
+
+struct PlanetGrid {
+    static const int TILE_SHIFT = 6;
+    static const int TILE = 1 << TILE_SHIFT; // 64
+    static const int TILE_MASK = TILE - 1;
+
+    int n = 0;            //   ĭ  (N)
+    int tilesPerSide = 0; //   Ÿ  ((N + 2) / 64 ø, ׵θ )
+    std::vector<uint8_t> cells;
+
+    // ũ⸦ ٲٰ  ĭ 0
+    void resize(int size) {
+        n = size;
+        tilesPerSide = (size + 2 + TILE - 1) >> TILE_SHIFT;
+        cells.assign(((size_t)6 * tilesPerSide * tilesPerSide) << (2 * TILE_SHIFT), 0);
+    }
+
+    int size() const { return n; }
+    bool inside(int r, int c) const { return r >= 0 && r < n && c >= 0 && c < n; }
+    size_t memoryBytes() const { return cells.size() * sizeof(uint8_t); }
+
+    // r, c -1 ~ n (׵θ ),   ĭ о 0 ~ n + 1
+    size_t index(int f, int r, int c) const {
+        r++; c++;
+        size_t tile = ((size_t)f * tilesPerSide + (r >> TILE_SHIFT)) * tilesPerSide + (c >> TILE_SHIFT);
+        return (tile << (2 * TILE_SHIFT)) + ((size_t)(r & TILE_MASK) << TILE_SHIFT) + (c & TILE_MASK);
+    }
+
+    uint8_t& at(int f, int r, int c) { return cells[index(f, r, c)]; }
+    uint8_t at(int f, int r, int c) const { return cells[index(f, r, c)]; }
+
+    // CSV   angle(90 )ŭ   face , invert01̸ 0 1 ٲ (CSV 0 = )
+    void placeCSV(int face, const GridCSV& csv, int angle, bool invert01) {
+        const GridRotation& g = gridRotation(angle); // CubeTopology.h ȸ ǥ
+        for (int fileRow = 0; fileRow < csv.rows && fileRow < n; fileRow++) {
+            for (int fileCol = 0; fileCol < csv.rowLength[fileRow] && fileCol < n; fileCol++) { //   ĭ 0 ״
+                int val = csv.cells[(size_t)fileRow * csv.cols + fileCol];
+                if (invert01) { if (val == 0) val = 1; else if (val == 1) val = 0; }
+
+                int tr = g.rr * fileRow + g.rc * fileCol + g.rk * (n - 1);
+                int tc = g.cr * fileRow + g.cc * fileCol + g.ck * (n - 1);
+                at(face, tr, tc) = (uint8_t)val;
+            }
+        }
+    }
+
+    // ׵θ ä:  f ٱ   (-1 Ǵ n ڸ, 𼭸 ) ̿   
+    //  ĭ  CubeTopology.h   ǥ (cubeSeamCell)
+    void fillHaloFace(int f) {
+        for (int i = -1; i <= n; i++) {
+            const int pr[4] = { -1, n, i, i };
+            const int pc[4] = { i, i, -1, n };
+            for (int k = 0; k < 4; k++) {
+                CubeCell t = cubeSeamCell(f, pr[k], pc[k], n);
+                at(f, pr[k], pc[k]) = at(t.f, t.r, t.c);
+            }
+        }
+    }
+
+    void fillHalo() {
+        for (int f = 0; f < 6; f++) fillHaloFace(f);
+    }
+
+    //  f [r0, r1) x [c0, c1) ĭ Ÿ   fn(r, c, ) ȣ
+    // Ÿ   ǥ ( ĭ и ǥ) 
+    template <typename Fn>
+    void forEachInRect(int f, int r0, int r1, int c0, int c1, Fn fn) {
+        for (int tr = (r0 + 1) & ~TILE_MASK; tr < r1 + 1; tr += TILE) {
+            for (int tc = (c0 + 1) & ~TILE_MASK; tc < c1 + 1; tc += TILE) {
+                int rs = (tr - 1 > r0) ? tr - 1 : r0, re = (tr - 1 + TILE < r1) ? tr - 1 + TILE : r1;
+                int cs = (tc - 1 > c0) ? tc - 1 : c0, ce = (tc - 1 + TILE < c1) ? tc - 1 + TILE : c1;
+                for (int r = rs; r < re; r++) {
+                    uint8_t* row = &cells[index(f, r, cs)];
+                    for (int c = cs; c < ce; c++) fn(r, c, row[c - cs]);
+                }
+            }
+        }
+    }
+
+    // 6 ü fn(f, r, c, ) 
+    template <typename Fn>
+    void forEach(Fn fn) {
+        for (int f = 0; f < 6; f++)
+            forEachInRect(f, 0, n, 0, n, [&](int r, int c, uint8_t& v) { fn(f, r, c, v); });
+    }
+};
+
+// ----------------------------------------------------------
+// [ Ʈ] (1) θ ĭ 1Ʈ,   64Ʈ    
+// ¿ (̿ )   Ʈ 4 ̸  
+//   = 64ĭ̶ Ʈ/AND   64ĭ  Ѳ 
+// ----------------------------------------------------------
+struct WallBits {
+    enum { CONN_L = 1, CONN_R = 2, CONN_U = 4, CONN_D = 8 }; // mask() ִ Ʈ
+
+    int n = 0;
+    int wordsPerRow = 0;
+    std::vector<uint64_t> wall;    // [][][], ĭ c =  c >> 6  Ʈ c & 63
+    std::vector<uint64_t> conn[4]; // L, R, U, D , wall  ġ
+
+    void resize(int size) {
+        n = size;
+        wordsPerRow = (size + 63) >> 6;
+        wall.assign((size_t)6 * size * wordsPerRow, 0);
+        for (int i = 0; i < 4; i++) conn[i].assign(wall.size(), 0);
+    }
+
+    size_t rowIndex(int f, int r) const { return ((size_t)f * n + r) * wordsPerRow; }
+    size_t memoryBytes() const { return wall.size() * sizeof(uint64_t) * 5; }
+
+    bool isWall(int f, int r, int c) const { return (wall[rowIndex(f, r) + (c >> 6)] >> (c & 63)) & 1; }
+
+    void set(int f, int r, int c, bool on) {
+        uint64_t& w = wall[rowIndex(f, r) + (c >> 6)];
+        uint64_t bit = (uint64_t)1 << (c & 63);
+        if (on) w |= bit; else w &= ~bit;
+    }
+
+    // ĭ (f, r, c)  4Ʈ (CONN_L | CONN_R | CONN_U | CONN_D),  ƴϸ 0
+    int mask(int f, int r, int c) const {
+        size_t i = rowIndex(f, r) + (c >> 6);
+        int b = c & 63;
+        return (int)((conn[0][i] >> b) & 1) | (int)(((conn[1][i] >> b) & 1) << 1)
+            | (int)(((conn[2][i] >> b) & 1) << 2) | (int)(((conn[3][i] >> b) & 1) << 3);
+    }
+
+    // ڿ  wallValue ĭ  Ʈ ( computeRows )
+    void fromGrid(PlanetGrid& grid, uint8_t wallValue) {
+        resize(grid.size());
+        grid.forEach([&](int f, int r, int c, uint8_t& v) { if (v == wallValue) set(f, r, c, true); });
+    }
+
+    //  f  r0 ~ r1-1  Ʈ 
+    //     Ʈ/AND,  ڸ ĭ ٱ ̿ outsideWall(f, r, c) 
+    template <typename Fn>
+    void computeRows(int f, int r0, int r1, Fn outsideWall) {
+        const int W = wordsPerRow;
+        for (int r = r0; r < r1; r++) {
+            size_t base = rowIndex(f, r);
+            const uint64_t* row = &wall[base];
+            const uint64_t* up = (r > 0) ? &wall[base - W] : nullptr;
+            const uint64_t* down = (r + 1 < n) ? &wall[base + W] : nullptr;
+            uint64_t* L = &conn[0][base];
+            uint64_t* R = &conn[1][base];
+            uint64_t* U = &conn[2][base];
+            uint64_t* D = &conn[3][base];
+
+            for (int k = 0; k < W; k++) {
+                uint64_t w = row[k];
+                uint64_t prev = (k > 0) ? row[k - 1] : 0;     //     Ʈ   0 ĭ 
+                uint64_t next = (k + 1 < W) ? row[k + 1] : 0; //   0 Ʈ   63 ĭ 
+                L[k] = w & ((w << 1) | (prev >> 63));
+                R[k] = w & ((w >> 1) | (next << 63));
+                U[k] = up ? (w & up[k]) : 0;
+                D[k] = down ? (w & down[k]) : 0;
+            }
+
+            //   ʸ ̿ (ึ   2ĭ,  /Ʒ   ü)
+            if (isWall(f, r, 0) && outsideWall(f, r, -1)) L[0] |= 1;
+            if (isWall(f, r, n - 1) && outsideWall(f, r, n)) R[(n - 1) >> 6] |= (uint64_t)1 << ((n - 1) & 63);
+            for (int c = 0; r == 0 && c < n; c++)
+                if (isWall(f, r, c) && outsideWall(f, -1, c)) U[c >> 6] |= (uint64_t)1 << (c & 63);
+            for (int c = 0; r == n - 1 && c < n; c++)
+                if (isWall(f, r, c) && outsideWall(f, n, c)) D[c >> 6] |= (uint64_t)1 << (c & 63);
+        }
+    }
+};
\ No newline at end of file
@@ -4,6 +4,7 @@
 #include <cmath>
 #include <cstdio>
 #include <cstdlib> 
+#include "ModelNormals.h"
 
 // ----------------------------------------------------------
 //  
@@ -13,6 +14,8 @@ struct Face { int v1, v2, v3; };
 
 std::vector<Point3D> vertices;
 std::vector<Face> faces;
+std::vector<Point3D> faceNormals, vertexNormals, cornerNormals; // ε     (cornerNormals = 鸶 3)
+float modelCreaseAngle = 60.0f; //    𼭸  
 
 // ----------------------------------------------------------
 //  
@@ -55,6 +58,7 @@ void loadModel(const char* filename) {
         Face f; fscanf(fp, "%d %d %d", &f.v1, &f.v2, &f.v3); faces.push_back(f);
     }
     fclose(fp);
+    buildModelNormals(vertices, faces, modelCreaseAngle, faceNormals, vertexNormals, cornerNormals);
 }
 
 void initMap() {
@@ -117,14 +121,12 @@ void drawScene() {
 
                 glBegin(GL_TRIANGLES);
                 for (int i = 0; i < faces.size(); i++) {
-                    Point3D p1 = vertices[faces[i].v1];
-                    Point3D p2 = vertices[faces[i].v2];
-                    Point3D p3 = vertices[faces[i].v3];
-                    Point3D n = calculateNormal(p1, p2, p3);
-                    glNormal3f(n.x, n.y, n.z);
-                    glVertex3f(p1.x, p1.y, p1.z);
-                    glVertex3f(p2.x, p2.y, p2.z);
-                    glVertex3f(p3.x, p3.y, p3.z);
+                    int idx[3] = { faces[i].v1, faces[i].v2, faces[i].v3 };
+                    for (int k = 0; k < 3; k++) {
+                        Point3D n = cornerNormals[i * 3 + k], p = vertices[idx[k]];
+                        glNormal3f(n.x, n.y, n.z);
+                        glVertex3f(p.x, p.y, p.z);
+                    }
                 }
                 glEnd();
             }
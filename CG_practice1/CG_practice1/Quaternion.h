@@ -0,0 +1,72 @@
+#pragma once
+// ----------------------------------------------------------
+// [ʹϾ] ༺ ȸ ¸ CPU  ʹϾ 
+// GL   ϸ (glRotatef + glMultMatrixf + glGetFloatv)   ̹  о ,
+//   ׿  ݾ   ->   ̸ 1 ǵ
+//  ׸  toMatrix  (glMultMatrixf  켱 4x4)
+// P x, y, z   ü(Point3D)
+// ----------------------------------------------------------
+#include <cmath>
+
+struct Quat {
+    float w = 1.0f, x = 0.0f, y = 0.0f, z = 0.0f;
+
+    // glRotatef(deg, ax, ay, az)  ȸ ( ̰ 0̸ ȸ )
+    static Quat axisAngle(float deg, float ax, float ay, float az) {
+        Quat q;
+        float len = sqrt(ax * ax + ay * ay + az * az);
+        if (len == 0.0f) return q;
+        float half = deg * 3.14159265f / 360.0f, s = sin(half) / len;
+        q.w = cos(half); q.x = ax * s; q.y = ay * s; q.z = az * s;
+        return q;
+    }
+
+    // a * b = b   a  (   )
+    friend Quat operator*(const Quat& a, const Quat& b) {
+        Quat q;
+        q.w = a.w * b.w - a.x * b.x - a.y * b.y - a.z * b.z;
+        q.x = a.w * b.x + a.x * b.w + a.y * b.z - a.z * b.y;
+        q.y = a.w * b.y - a.x * b.z + a.y * b.w + a.z * b.x;
+        q.z = a.w * b.z + a.x * b.y - a.y * b.x + a.z * b.w;
+        return q;
+    }
+
+    void normalize() {
+        float len = sqrt(w * w + x * x + y * y + z * z);
+        if (len == 0.0f) { w = 1.0f; x = y = z = 0.0f; return; }
+        w /= len; x /= len; y /= len; z /= len;
+    }
+
+    //   ѷ  =  glLoadIdentity(); glRotatef(...); glMultMatrixf( );
+    void rotateWorld(float deg, float ax, float ay, float az) { *this = axisAngle(deg, ax, ay, az) * *this; normalize(); }
+    // ༺   ѷ  =   * ȸ
+    void rotateLocal(float deg, float ax, float ay, float az) { *this = *this * axisAngle(deg, ax, ay, az); normalize(); }
+
+    // ༺  ->  (v + 2w(u x v) + 2u x (u x v), u = (x, y, z))
+    template <typename P>
+    P apply(const P& p) const {
+        float tx = 2.0f * (y * p.z - z * p.y), ty = 2.0f * (z * p.x - x * p.z), tz = 2.0f * (x * p.y - y * p.x);
+        P r = {
+            p.x + w * tx + (y * tz - z * ty),
+            p.y + w * ty + (z * tx - x * tz),
+            p.z + w * tz + (x * ty - y * tx)
+        };
+        return r;
+    }
+
+    //  -> ༺  (ӷ )
+    template <typename P>
+    P applyInverse(const P& p) const {
+        Quat c = *this;
+        c.x = -x; c.y = -y; c.z = -z;
+        return c.apply(p);
+    }
+
+    //  켱 4x4 ȸ 
+    void toMatrix(float* m) const {
+        m[0] = 1 - 2 * (y * y + z * z); m[4] = 2 * (x * y - z * w);     m[8] = 2 * (x * z + y * w);      m[12] = 0;
+        m[1] = 2 * (x * y + z * w);     m[5] = 1 - 2 * (x * x + z * z); m[9] = 2 * (y * z - x * w);      m[13] = 0;
+        m[2] = 2 * (x * z - y * w);     m[6] = 2 * (y * z + x * w);     m[10] = 1 - 2 * (x * x + y * y); m[14] = 0;
+        m[3] = 0; m[7] = 0; m[11] = 0; m[15] = 1;
+    }
+};
\ No newline at end of file
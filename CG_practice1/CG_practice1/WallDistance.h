@@ -0,0 +1,168 @@
+#pragma once
+// ----------------------------------------------------------
+// [ Ÿ] ĭ    ĭ Ÿ (ĭ )
+// ¿ 1ĭ, 밢 1.41ĭ  è Ÿ 1/16ĭ  uint8  ( 16ĭ  255)
+// ʰ  PlanetGrid Ƽ ׵θ(halo)   ʸ  б  
+// - build : 鸶 /ڷ ȴ н   ٲ  ݺ (  ݺ ׵θ )
+// - update: ĭ ϳ ٲ Ÿ (16ĭ)  ĭ ٽ 
+// - sample:  ǥ (getSpherePoint  x, y) ĭ   4 ּ 
+// ----------------------------------------------------------
+#include <vector>
+#include <unordered_map>
+#include <cmath>
+#include <algorithm>
+#include "PlanetGrid.h"
+#include "CubeTopology.h"
+
+struct WallDistance {
+    static const int UNIT = 16;        // 1ĭ
+    static const int DIAG = 23;        // 밢 1ĭ (16 * 1.414)
+    static const int FAR_VALUE = 255;  // Ÿ  ( 16ĭ)
+    static const int UPDATE_HOPS = 23; //   ĭ ¿   (16ĭ * 1.414)
+
+    PlanetGrid dist;
+    int passes = 0; //  build ݺ Ƚ
+    std::vector<uint8_t> scratch; // build   ϳ + ׵θ  پ    ((n + 2) x (n + 2))
+
+    float maxCells() const { return FAR_VALUE / (float)UNIT; }
+    float cells(int f, int r, int c) const { return dist.at(f, r, c) / (float)UNIT; }
+
+    // (f, r, c) (dr, dc)  ĭ,  ̸ ̿  ĭ
+    // 밢  𼭸 (,    )  ̿ 
+    static bool step(int n, int f, int r, int c, int dr, int dc, CubeCell& out) {
+        int nr = r + dr, nc = c + dc;
+        if ((nr < 0 || nr >= n) && (nc < 0 || nc >= n)) return false;
+        out = cubeSeamCell(f, nr, nc, n);
+        return true;
+    }
+
+    void build(const WallBits& walls) {
+        int n = walls.n;
+        dist.resize(n);
+        dist.forEach([&](int f, int r, int c, uint8_t& v) { v = walls.isWall(f, r, c) ? 0 : FAR_VALUE; });
+
+        passes = 0;
+        bool changed = true;
+        while (changed) {
+            dist.fillHalo();
+            changed = false;
+            for (int f = 0; f < 6; f++) changed = sweep(f) | changed;
+            passes++;
+        }
+    }
+
+    //  ϳ  (  3ĭ + ʿ)  , ڷ (Ʒ  3ĭ + ʿ)  
+    // Ÿ    پ ģ scratch  (̿ =  +-1, +-W)
+    //  𼭸  ׵θ 4ĭ FAR_VALUE ּ 밢 Ѿ ʰ 
+    bool sweep(int f) {
+        int n = dist.size(), W = n + 2;
+        scratch.resize((size_t)W * W);
+        uint8_t* s = scratch.data();
+        for (int i = -1; i <= n; i++) {
+            s[i + 1] = dist.at(f, -1, i); s[(size_t)(n + 1) * W + i + 1] = dist.at(f, n, i);
+            s[(size_t)(i + 1) * W] = dist.at(f, i, -1); s[(size_t)(i + 1) * W + n + 1] = dist.at(f, i, n);
+        }
+        s[0] = s[n + 1] = s[(size_t)(n + 1) * W] = s[(size_t)(n + 1) * W + n + 1] = FAR_VALUE;
+        dist.forEachInRect(f, 0, n, 0, n, [&](int r, int c, uint8_t& v) { s[(size_t)(r + 1) * W + c + 1] = v; });
+
+        bool changed = false;
+        for (int r = 1; r <= n; r++) {
+            uint8_t* p = s + (size_t)r * W;
+            for (int c = 1; c <= n; c++) {
+                int v = p[c];
+                if (v == 0) continue;
+                int best = v;
+                best = std::min(best, p[c - W - 1] + DIAG);
+                best = std::min(best, p[c - W] + UNIT);
+                best = std::min(best, p[c - W + 1] + DIAG);
+                best = std::min(best, p[c - 1] + UNIT);
+                if (best < v) { p[c] = (uint8_t)best; changed = true; }
+            }
+        }
+        for (int r = n; r >= 1; r--) {
+            uint8_t* p = s + (size_t)r * W;
+            for (int c = n; c >= 1; c--) {
+                int v = p[c];
+                if (v == 0) continue;
+                int best = v;
+                best = std::min(best, p[c + W + 1] + DIAG);
+                best = std::min(best, p[c + W] + UNIT);
+                best = std::min(best, p[c + W - 1] + DIAG);
+                best = std::min(best, p[c + 1] + UNIT);
+                if (best < v) { p[c] = (uint8_t)best; changed = true; }
+            }
+        }
+
+        if (changed) dist.forEachInRect(f, 0, n, 0, n, [&](int r, int c, uint8_t& v) { v = s[(size_t)(r + 1) * W + c + 1]; });
+        return changed;
+    }
+
+    // 8 ̿ ο (׵θ    ǥ  ã)
+    bool relaxAll(int f, int r, int c) {
+        uint8_t& v = dist.at(f, r, c);
+        if (v == 0) return false;
+        int n = dist.size();
+        int best = v;
+        for (int dr = -1; dr <= 1; dr++)
+            for (int dc = -1; dc <= 1; dc++) {
+                CubeCell nb;
+                if ((dr == 0 && dc == 0) || !step(n, f, r, c, dr, dc, nb)) continue;
+                int cand = dist.at(nb.f, nb.r, nb.c) + ((dr == 0 || dc == 0) ? UNIT : DIAG);
+                if (cand < best) best = cand;
+            }
+        if (best >= v) return false;
+        v = (uint8_t)best;
+        return true;
+    }
+
+    // ĭ (f0, r0, c0)  ΰ ٲ  ȣ
+    // Ÿ   ĭ  ĭ Ƿ,   ĭ ó   ٽ ȭ
+    void update(const WallBits& walls, int f0, int r0, int c0) {
+        int n = dist.size();
+        auto key = [n](const CubeCell& k) { return ((long long)k.f * n + k.r) * n + k.c; };
+
+        std::vector<CubeCell> region;
+        std::vector<int> hops;
+        std::unordered_map<long long, int> seen;
+        CubeCell start = { f0, r0, c0 };
+        region.push_back(start); hops.push_back(0); seen[key(start)] = 0;
+        const int dr[4] = { -1, 1, 0, 0 };
+        const int dc[4] = { 0, 0, -1, 1 };
+        for (size_t i = 0; i < region.size(); i++) {
+            if (hops[i] == UPDATE_HOPS) continue;
+            for (int k = 0; k < 4; k++) {
+                CubeCell nb;
+                if (!step(n, region[i].f, region[i].r, region[i].c, dr[k], dc[k], nb)) continue;
+                if (seen.count(key(nb))) continue;
+                seen[key(nb)] = (int)region.size();
+                region.push_back(nb); hops.push_back(hops[i] + 1);
+            }
+        }
+
+        for (const CubeCell& k : region) dist.at(k.f, k.r, k.c) = walls.isWall(k.f, k.r, k.c) ? 0 : FAR_VALUE;
+        bool changed = true;
+        while (changed) {
+            changed = false;
+            for (const CubeCell& k : region) changed = relaxAll(k.f, k.r, k.c) | changed;
+        }
+        dist.fillHalo();
+    }
+
+    //  f  ǥ (x, y: -1 ~ 1) Ÿ (ĭ )
+    float sample(int f, float x, float y) const {
+        int n = dist.size();
+        float fx = (x + 1.0f) * 0.5f * n - 0.5f; // ĭ   Ǵ ǥ
+        float fy = (y + 1.0f) * 0.5f * n - 0.5f;
+        int c0 = (int)floor(fx), r0 = (int)floor(fy);
+        c0 = (c0 < -1) ? -1 : (c0 > n - 1) ? n - 1 : c0; // -1, n ׵θ
+        r0 = (r0 < -1) ? -1 : (r0 > n - 1) ? n - 1 : r0;
+        float tx = fx - c0, ty = fy - r0;
+        tx = (tx < 0) ? 0 : (tx > 1) ? 1 : tx;
+        ty = (ty < 0) ? 0 : (ty > 1) ? 1 : ty;
+
+        float v00 = dist.at(f, r0, c0), v01 = dist.at(f, r0, c0 + 1);
+        float v10 = dist.at(f, r0 + 1, c0), v11 = dist.at(f, r0 + 1, c0 + 1);
+        float v = (1 - ty) * ((1 - tx) * v00 + tx * v01) + ty * ((1 - tx) * v10 + tx * v11);
+        return v / UNIT;
+    }
+};
\ No newline at end of file